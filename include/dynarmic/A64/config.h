@@ -179,6 +179,11 @@ struct UserConfig {
     /// Determines if the above option only triggers when the misalignment straddles a
     /// page boundary.
     bool only_detect_misalignment_via_page_table_on_page_boundary = false;
+    /// Determines if memory accesses off a common base register within a block may share a
+    /// single page_table lookup, and adjacent loads may be merged into one host load.
+    /// If this is true, page_table must not be altered from within memory callbacks.
+    /// This is only used if page_table is not nullptr.
+    bool reuse_page_table_lookups = false;
 
 
     /// This option relates to translation. Generally when we run into an unpredictable
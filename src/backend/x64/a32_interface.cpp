@@ -137,6 +137,9 @@ private:
         Optimization::DeadCodeElimination(ir_block);
         Optimization::A32ConstantMemoryReads(ir_block, config.callbacks);
         Optimization::ConstantPropagation(ir_block);
+        Optimization::RedundantExtensionElimination(ir_block);
+        Optimization::CommonSubexpressionElimination(ir_block);
+        Optimization::RedundantLoadStoreElimination(ir_block);
         Optimization::DeadCodeElimination(ir_block);
         Optimization::VerificationPass(ir_block);
         return emitter.Emit(ir_block);
@@ -4,7 +4,9 @@
  * General Public License version 2 or any later version.
  */
 
+#include <algorithm>
 #include <initializer_list>
+#include <vector>
 
 #include <dynarmic/A64/exclusive_monitor.h>
 #include <fmt/format.h>
@@ -756,13 +758,75 @@ void EmitDetectMisaignedVAddr(BlockOfCode& code, A64EmitContext& ctx, size_t bit
     code.SwitchToNearCode();
 }
 
-Xbyak::RegExp EmitVAddrLookup(BlockOfCode& code, A64EmitContext& ctx, size_t bitsize, Xbyak::Label& abort, Xbyak::Reg64 vaddr, std::optional<Xbyak::Reg64> arg_scratch = {}) {
+/// A register containing the virtual address of a memory access.
+struct VAddr {
+    Xbyak::Reg64 reg;
+    /// If set, the register is not the home of any IR value and may be clobbered once the address is no longer needed.
+    bool is_scratch;
+};
+
+/// Computes the virtual address base + (offset << shift) of a memory access with at most one host instruction.
+VAddr EmitVAddr(BlockOfCode& code, A64EmitContext& ctx, Argument& base, Argument& offset, Argument& shift) {
+    const u8 shift_amount = shift.GetImmediateU8();
+
+    if (offset.IsImmediate()) {
+        const u64 displacement = offset.GetImmediateU64() << shift_amount;
+        if (displacement == 0) {
+            return {ctx.reg_alloc.UseGpr(base), false};
+        }
+
+        if (offset.FitsInImmediateS32() && shift_amount == 0) {
+            const Xbyak::Reg64 source = ctx.reg_alloc.UseGpr(base);
+            const Xbyak::Reg64 vaddr = ctx.reg_alloc.ScratchGpr();
+            code.lea(vaddr, code.ptr[source + static_cast<s32>(displacement)]);
+            return {vaddr, true};
+        }
+
+        const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseScratchGpr(base);
+        const Xbyak::Reg64 tmp = ctx.reg_alloc.ScratchGpr();
+        code.mov(tmp, displacement);
+        code.add(vaddr, tmp);
+        return {vaddr, true};
+    }
+
+    ASSERT(shift_amount <= 3);
+    const Xbyak::Reg64 source = ctx.reg_alloc.UseGpr(base);
+    const Xbyak::Reg64 index = ctx.reg_alloc.UseGpr(offset);
+    const Xbyak::Reg64 vaddr = ctx.reg_alloc.ScratchGpr();
+    code.lea(vaddr, code.ptr[source + index * (1 << shift_amount)]);
+    return {vaddr, true};
+}
+
+/// Adds offset << shift to the virtual address in ABI_PARAM2, after the base has been placed there for a host call.
+/// A non-immediate offset is expected to be in `index`.
+void EmitVAddrForCall(BlockOfCode& code, Argument& offset, Argument& shift, Xbyak::Reg64 index) {
+    const u8 shift_amount = shift.GetImmediateU8();
+
+    if (offset.IsImmediate()) {
+        const u64 displacement = offset.GetImmediateU64() << shift_amount;
+        if (displacement == 0) {
+            return;
+        }
+
+        if (offset.FitsInImmediateS32() && shift_amount == 0) {
+            code.add(code.ABI_PARAM2, static_cast<s32>(displacement));
+        } else {
+            code.mov(code.ABI_RETURN, displacement);
+            code.add(code.ABI_PARAM2, code.ABI_RETURN);
+        }
+        return;
+    }
+
+    ASSERT(shift_amount <= 3);
+    code.lea(code.ABI_PARAM2, code.ptr[code.ABI_PARAM2 + index * (1 << shift_amount)]);
+}
+
+/// Looks up vaddr in the page table using the given registers, which allows the lookup to be emitted into far code.
+Xbyak::RegExp EmitVAddrLookup(BlockOfCode& code, A64EmitContext& ctx, size_t bitsize, Xbyak::Label& abort, VAddr vaddr_info, Xbyak::Reg64 page_table, Xbyak::Reg64 tmp) {
+    const Xbyak::Reg64 vaddr = vaddr_info.reg;
     const size_t valid_page_index_bits = ctx.conf.page_table_address_space_bits - page_bits;
     const size_t unused_top_bits = 64 - ctx.conf.page_table_address_space_bits;
 
-    const Xbyak::Reg64 page_table = arg_scratch ? *arg_scratch : ctx.reg_alloc.ScratchGpr();
-    const Xbyak::Reg64 tmp = ctx.reg_alloc.ScratchGpr();
-
     EmitDetectMisaignedVAddr(code, ctx, bitsize, abort, vaddr, tmp);
 
     code.mov(page_table, reinterpret_cast<u64>(ctx.conf.page_table));
@@ -789,18 +853,94 @@ Xbyak::RegExp EmitVAddrLookup(BlockOfCode& code, A64EmitContext& ctx, size_t bit
     if (ctx.conf.absolute_offset_page_table) {
         return page_table + vaddr;
     }
+    // No path to the abort label remains, so a scratch address is no longer needed for the fallback.
+    if (vaddr_info.is_scratch) {
+        code.and_(vaddr, static_cast<u32>(page_size - 1));
+        return page_table + vaddr;
+    }
     code.mov(tmp, vaddr);
     code.and_(tmp, static_cast<u32>(page_size - 1));
     return page_table + tmp;
 }
 
+/// General purpose registers borrowed for the duration of a far-code path by saving them on the stack, so that
+/// the near-code fast path does not have to reserve registers only the slow path uses. The stack is kept aligned
+/// for calls to the fallbacks. Values in registers other than those borrowed remain available throughout.
+class FarCodeScratch {
+public:
+    FarCodeScratch(BlockOfCode& code, size_t count, std::initializer_list<Xbyak::Reg64> in_use) : code(code) {
+        for (int idx = 0; idx < 15 && regs.size() < count; idx++) {
+            const bool is_in_use = std::any_of(in_use.begin(), in_use.end(), [idx](const auto& reg) { return reg.getIdx() == idx; });
+            if (idx != code.rsp.getIdx() && !is_in_use) {
+                regs.emplace_back(idx);
+            }
+        }
+        ASSERT(regs.size() == count);
+    }
+
+    Xbyak::Reg64 operator[](size_t index) const {
+        return regs.at(index);
+    }
+
+    void Save() const {
+        for (const auto& reg : regs) {
+            code.push(reg);
+        }
+        if (regs.size() % 2 != 0) {
+            code.sub(code.rsp, 8);
+        }
+    }
+
+    /// Emitted on every exit from the far-code path.
+    void Restore() const {
+        if (regs.size() % 2 != 0) {
+            code.add(code.rsp, 8);
+        }
+        for (auto iter = regs.rbegin(); iter != regs.rend(); ++iter) {
+            code.pop(*iter);
+        }
+    }
+
+private:
+    BlockOfCode& code;
+    std::vector<Xbyak::Reg64> regs;
+};
+
+Xbyak::RegExp EmitVAddrLookup(BlockOfCode& code, A64EmitContext& ctx, size_t bitsize, Xbyak::Label& abort, VAddr vaddr_info, std::optional<Xbyak::Reg64> arg_scratch = {}) {
+    const Xbyak::Reg64 page_table = arg_scratch ? *arg_scratch : ctx.reg_alloc.ScratchGpr();
+    const Xbyak::Reg64 tmp = ctx.reg_alloc.ScratchGpr();
+    return EmitVAddrLookup(code, ctx, bitsize, abort, vaddr_info, page_table, tmp);
+}
+
+/// Places the virtual address of a read or write callback in ABI_PARAM2 and, for a write, the value in ABI_PARAM3.
+/// The result of a read is defined as `result`.
+void EmitMemoryCallbackArgs(BlockOfCode& code, A64EmitContext& ctx, RegAlloc::ArgumentInfo& args, bool is_write, IR::Inst* result = nullptr) {
+    if (args[1].IsImmediate()) {
+        if (is_write) {
+            ctx.reg_alloc.HostCall(nullptr, {}, args[0], args[3]);
+        } else {
+            ctx.reg_alloc.HostCall(result, {}, args[0]);
+        }
+        EmitVAddrForCall(code, args[1], args[2], code.ABI_PARAM3);
+        return;
+    }
+
+    if (is_write) {
+        ctx.reg_alloc.HostCall(nullptr, {}, args[0], args[3], args[1]);
+        EmitVAddrForCall(code, args[1], args[2], code.ABI_PARAM4);
+    } else {
+        ctx.reg_alloc.HostCall(result, {}, args[0], args[1]);
+        EmitVAddrForCall(code, args[1], args[2], code.ABI_PARAM3);
+    }
+}
+
 } // anonymous namepsace
 
 void A64EmitX64::EmitDirectPageTableMemoryRead(A64EmitContext& ctx, IR::Inst* inst, size_t bitsize) {
     Xbyak::Label abort, end;
 
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
+    const VAddr vaddr = EmitVAddr(code, ctx, args[0], args[1], args[2]);
     const Xbyak::Reg64 value = ctx.reg_alloc.ScratchGpr();
 
     const auto src_ptr = EmitVAddrLookup(code, ctx, bitsize, abort, vaddr, value);
@@ -822,7 +962,7 @@ void A64EmitX64::EmitDirectPageTableMemoryRead(A64EmitContext& ctx, IR::Inst* in
 
     code.SwitchToFarCode();
     code.L(abort);
-    code.call(read_fallbacks[std::make_tuple(bitsize, vaddr.getIdx(), value.getIdx())]);
+    code.call(read_fallbacks[std::make_tuple(bitsize, vaddr.reg.getIdx(), value.getIdx())]);
     code.jmp(end, code.T_NEAR);
     code.SwitchToNearCode();
 
@@ -833,8 +973,8 @@ void A64EmitX64::EmitDirectPageTableMemoryWrite(A64EmitContext& ctx, IR::Inst* i
     Xbyak::Label abort, end;
 
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
-    const Xbyak::Reg64 value = ctx.reg_alloc.UseGpr(args[1]);
+    const VAddr vaddr = EmitVAddr(code, ctx, args[0], args[1], args[2]);
+    const Xbyak::Reg64 value = ctx.reg_alloc.UseGpr(args[3]);
 
     const auto dest_ptr = EmitVAddrLookup(code, ctx, bitsize, abort, vaddr);
     switch (bitsize) {
@@ -855,7 +995,7 @@ void A64EmitX64::EmitDirectPageTableMemoryWrite(A64EmitContext& ctx, IR::Inst* i
 
     code.SwitchToFarCode();
     code.L(abort);
-    code.call(write_fallbacks[std::make_tuple(bitsize, vaddr.getIdx(), value.getIdx())]);
+    code.call(write_fallbacks[std::make_tuple(bitsize, vaddr.reg.getIdx(), value.getIdx())]);
     code.jmp(end, code.T_NEAR);
     code.SwitchToNearCode();
 }
@@ -867,7 +1007,7 @@ void A64EmitX64::EmitA64ReadMemory8(A64EmitContext& ctx, IR::Inst* inst) {
     }
 
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    ctx.reg_alloc.HostCall(inst, {}, args[0]);
+    EmitMemoryCallbackArgs(code, ctx, args, false, inst);
     Devirtualize<&A64::UserCallbacks::MemoryRead8>(conf.callbacks).EmitCall(code);
 }
 
@@ -878,7 +1018,7 @@ void A64EmitX64::EmitA64ReadMemory16(A64EmitContext& ctx, IR::Inst* inst) {
     }
 
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    ctx.reg_alloc.HostCall(inst, {}, args[0]);
+    EmitMemoryCallbackArgs(code, ctx, args, false, inst);
     Devirtualize<&A64::UserCallbacks::MemoryRead16>(conf.callbacks).EmitCall(code);
 }
 
@@ -889,7 +1029,7 @@ void A64EmitX64::EmitA64ReadMemory32(A64EmitContext& ctx, IR::Inst* inst) {
     }
 
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    ctx.reg_alloc.HostCall(inst, {}, args[0]);
+    EmitMemoryCallbackArgs(code, ctx, args, false, inst);
     Devirtualize<&A64::UserCallbacks::MemoryRead32>(conf.callbacks).EmitCall(code);
 }
 
@@ -900,7 +1040,7 @@ void A64EmitX64::EmitA64ReadMemory64(A64EmitContext& ctx, IR::Inst* inst) {
     }
 
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    ctx.reg_alloc.HostCall(inst, {}, args[0]);
+    EmitMemoryCallbackArgs(code, ctx, args, false, inst);
     Devirtualize<&A64::UserCallbacks::MemoryRead64>(conf.callbacks).EmitCall(code);
 }
 
@@ -909,7 +1049,7 @@ void A64EmitX64::EmitA64ReadMemory128(A64EmitContext& ctx, IR::Inst* inst) {
         Xbyak::Label abort, end;
 
         auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-        const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
+        const VAddr vaddr = EmitVAddr(code, ctx, args[0], args[1], args[2]);
         const Xbyak::Xmm value = ctx.reg_alloc.ScratchXmm();
 
         const auto src_ptr = EmitVAddrLookup(code, ctx, 128, abort, vaddr);
@@ -918,7 +1058,7 @@ void A64EmitX64::EmitA64ReadMemory128(A64EmitContext& ctx, IR::Inst* inst) {
 
         code.SwitchToFarCode();
         code.L(abort);
-        code.call(read_fallbacks[std::make_tuple(128, vaddr.getIdx(), value.getIdx())]);
+        code.call(read_fallbacks[std::make_tuple(128, vaddr.reg.getIdx(), value.getIdx())]);
         code.jmp(end, code.T_NEAR);
         code.SwitchToNearCode();
 
@@ -927,7 +1067,12 @@ void A64EmitX64::EmitA64ReadMemory128(A64EmitContext& ctx, IR::Inst* inst) {
     }
 
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    ctx.reg_alloc.HostCall(nullptr, {}, args[0]);
+    if (args[1].IsImmediate()) {
+        ctx.reg_alloc.HostCall(nullptr, {}, args[0]);
+    } else {
+        ctx.reg_alloc.HostCall(nullptr, {}, args[0], args[1]);
+    }
+    EmitVAddrForCall(code, args[1], args[2], code.ABI_PARAM3);
     code.CallFunction(memory_read_128);
     ctx.reg_alloc.DefineValue(inst, xmm1);
 }
@@ -939,7 +1084,7 @@ void A64EmitX64::EmitA64WriteMemory8(A64EmitContext& ctx, IR::Inst* inst) {
     }
 
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    ctx.reg_alloc.HostCall(nullptr, {}, args[0], args[1]);
+    EmitMemoryCallbackArgs(code, ctx, args, true);
     Devirtualize<&A64::UserCallbacks::MemoryWrite8>(conf.callbacks).EmitCall(code);
 }
 
@@ -950,7 +1095,7 @@ void A64EmitX64::EmitA64WriteMemory16(A64EmitContext& ctx, IR::Inst* inst) {
     }
 
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    ctx.reg_alloc.HostCall(nullptr, {}, args[0], args[1]);
+    EmitMemoryCallbackArgs(code, ctx, args, true);
     Devirtualize<&A64::UserCallbacks::MemoryWrite16>(conf.callbacks).EmitCall(code);
 }
 
@@ -961,7 +1106,7 @@ void A64EmitX64::EmitA64WriteMemory32(A64EmitContext& ctx, IR::Inst* inst) {
     }
 
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    ctx.reg_alloc.HostCall(nullptr, {}, args[0], args[1]);
+    EmitMemoryCallbackArgs(code, ctx, args, true);
     Devirtualize<&A64::UserCallbacks::MemoryWrite32>(conf.callbacks).EmitCall(code);
 }
 
@@ -972,7 +1117,7 @@ void A64EmitX64::EmitA64WriteMemory64(A64EmitContext& ctx, IR::Inst* inst) {
     }
 
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    ctx.reg_alloc.HostCall(nullptr, {}, args[0], args[1]);
+    EmitMemoryCallbackArgs(code, ctx, args, true);
     Devirtualize<&A64::UserCallbacks::MemoryWrite64>(conf.callbacks).EmitCall(code);
 }
 
@@ -981,8 +1126,8 @@ void A64EmitX64::EmitA64WriteMemory128(A64EmitContext& ctx, IR::Inst* inst) {
         Xbyak::Label abort, end;
 
         auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-        const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
-        const Xbyak::Xmm value = ctx.reg_alloc.UseXmm(args[1]);
+        const VAddr vaddr = EmitVAddr(code, ctx, args[0], args[1], args[2]);
+        const Xbyak::Xmm value = ctx.reg_alloc.UseXmm(args[3]);
 
         const auto dest_ptr = EmitVAddrLookup(code, ctx, 128, abort, vaddr);
         code.movups(xword[dest_ptr], value);
@@ -990,7 +1135,7 @@ void A64EmitX64::EmitA64WriteMemory128(A64EmitContext& ctx, IR::Inst* inst) {
 
         code.SwitchToFarCode();
         code.L(abort);
-        code.call(write_fallbacks[std::make_tuple(128, vaddr.getIdx(), value.getIdx())]);
+        code.call(write_fallbacks[std::make_tuple(128, vaddr.reg.getIdx(), value.getIdx())]);
         code.jmp(end, code.T_NEAR);
         code.SwitchToNearCode();
         return;
@@ -998,12 +1143,363 @@ void A64EmitX64::EmitA64WriteMemory128(A64EmitContext& ctx, IR::Inst* inst) {
 
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     ctx.reg_alloc.Use(args[0], ABI_PARAM2);
-    ctx.reg_alloc.Use(args[1], HostLoc::XMM1);
+    if (!args[1].IsImmediate()) {
+        ctx.reg_alloc.Use(args[1], ABI_PARAM3);
+    }
+    ctx.reg_alloc.Use(args[3], HostLoc::XMM1);
     ctx.reg_alloc.EndOfAllocScope();
     ctx.reg_alloc.HostCall(nullptr);
+    EmitVAddrForCall(code, args[1], args[2], code.ABI_PARAM3);
     code.CallFunction(memory_write_128);
 }
 
+void A64EmitX64::EmitA64GetPageHandle(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (!conf.page_table) {
+        const Xbyak::Reg64 handle = ctx.reg_alloc.ScratchGpr();
+        code.xor_(handle.cvt32(), handle.cvt32());
+        ctx.reg_alloc.DefineValue(inst, handle);
+        return;
+    }
+
+    Xbyak::Label abort, end;
+
+    const Xbyak::Reg64 base = ctx.reg_alloc.UseGpr(args[0]);
+    const s32 first = static_cast<s32>(args[1].GetImmediateU64());
+    const s32 last = static_cast<s32>(args[2].GetImmediateU64());
+    const Xbyak::Reg64 vaddr = ctx.reg_alloc.ScratchGpr();
+    const Xbyak::Reg64 handle = ctx.reg_alloc.ScratchGpr();
+    const Xbyak::Reg64 tmp = ctx.reg_alloc.ScratchGpr();
+
+    // The accesses sharing this handle must all lie within the page of the first byte.
+    // Otherwise the handle is zero, and each access performs its own lookup.
+    code.lea(vaddr, code.ptr[base + first]);
+    code.lea(handle, code.ptr[base + last]);
+    code.xor_(handle, vaddr);
+    code.test(handle, static_cast<u32>(~(page_size - 1)));
+    code.jnz(abort, code.T_NEAR);
+
+    // The handle is the host address that corresponds to base, so that base + disp maps to handle + disp.
+    const auto page_ptr = EmitVAddrLookup(code, ctx, 8, abort, VAddr{vaddr, true}, handle, tmp);
+    code.lea(handle, code.ptr[page_ptr - first]);
+    code.L(end);
+
+    code.SwitchToFarCode();
+    code.L(abort);
+    code.xor_(handle.cvt32(), handle.cvt32());
+    code.jmp(end, code.T_NEAR);
+    code.SwitchToNearCode();
+
+    ctx.reg_alloc.DefineValue(inst, handle);
+}
+
+void A64EmitX64::EmitPagedMemoryRead(A64EmitContext& ctx, IR::Inst* inst, size_t bitsize) {
+    Xbyak::Label lookup, abort, end;
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const Xbyak::Reg64 handle = ctx.reg_alloc.UseGpr(args[0]);
+    const Xbyak::Reg64 base = ctx.reg_alloc.UseGpr(args[1]);
+    const s32 displacement = static_cast<s32>(args[2].GetImmediateU64());
+
+    if (bitsize == 128) {
+        const Xbyak::Xmm value = ctx.reg_alloc.ScratchXmm();
+
+        code.test(handle, handle);
+        code.jz(lookup, code.T_NEAR);
+        code.movups(value, xword[handle + displacement]);
+        code.L(end);
+
+        // The handle is known to be zero here, so it serves as a temporary and is cleared again on exit.
+        code.SwitchToFarCode();
+        code.L(lookup);
+        const FarCodeScratch scratch{code, displacement == 0 ? size_t(1) : size_t(2), {handle, base}};
+        const VAddr vaddr = displacement == 0 ? VAddr{base, false} : VAddr{scratch[1], true};
+        scratch.Save();
+        if (vaddr.is_scratch) {
+            code.lea(vaddr.reg, code.ptr[base + displacement]);
+        }
+        code.movups(value, xword[EmitVAddrLookup(code, ctx, 128, abort, vaddr, scratch[0], handle)]);
+        code.xor_(handle.cvt32(), handle.cvt32());
+        scratch.Restore();
+        code.jmp(end, code.T_NEAR);
+        code.L(abort);
+        code.call(read_fallbacks[std::make_tuple(128, vaddr.reg.getIdx(), value.getIdx())]);
+        code.xor_(handle.cvt32(), handle.cvt32());
+        scratch.Restore();
+        code.jmp(end, code.T_NEAR);
+        code.SwitchToNearCode();
+
+        ctx.reg_alloc.DefineValue(inst, value);
+        return;
+    }
+
+    const Xbyak::Reg64 value = ctx.reg_alloc.ScratchGpr();
+
+    const auto load = [&](Xbyak::RegExp src_ptr) {
+        switch (bitsize) {
+        case 8:
+            code.movzx(value.cvt32(), code.byte[src_ptr]);
+            break;
+        case 16:
+            code.movzx(value.cvt32(), word[src_ptr]);
+            break;
+        case 32:
+            code.mov(value.cvt32(), dword[src_ptr]);
+            break;
+        case 64:
+            code.mov(value, qword[src_ptr]);
+            break;
+        }
+    };
+
+    code.test(handle, handle);
+    code.jz(lookup, code.T_NEAR);
+    load(handle + displacement);
+    code.L(end);
+
+    // The handle is known to be zero here, so it serves as a temporary and is cleared again on exit.
+    // The destination holds the page pointer until it is overwritten by the load.
+    code.SwitchToFarCode();
+    code.L(lookup);
+    const FarCodeScratch scratch{code, displacement == 0 ? size_t(0) : size_t(1), {handle, base, value}};
+    const VAddr vaddr = displacement == 0 ? VAddr{base, false} : VAddr{scratch[0], true};
+    scratch.Save();
+    if (vaddr.is_scratch) {
+        code.lea(vaddr.reg, code.ptr[base + displacement]);
+    }
+    load(EmitVAddrLookup(code, ctx, bitsize, abort, vaddr, value, handle));
+    code.xor_(handle.cvt32(), handle.cvt32());
+    scratch.Restore();
+    code.jmp(end, code.T_NEAR);
+    code.L(abort);
+    code.call(read_fallbacks[std::make_tuple(bitsize, vaddr.reg.getIdx(), value.getIdx())]);
+    code.xor_(handle.cvt32(), handle.cvt32());
+    scratch.Restore();
+    code.jmp(end, code.T_NEAR);
+    code.SwitchToNearCode();
+
+    ctx.reg_alloc.DefineValue(inst, value);
+}
+
+void A64EmitX64::EmitPagedMemoryWrite(A64EmitContext& ctx, IR::Inst* inst, size_t bitsize) {
+    Xbyak::Label lookup, abort, end;
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const Xbyak::Reg64 handle = ctx.reg_alloc.UseGpr(args[0]);
+    const Xbyak::Reg64 base = ctx.reg_alloc.UseGpr(args[1]);
+    const s32 displacement = static_cast<s32>(args[2].GetImmediateU64());
+
+    if (bitsize == 128) {
+        const Xbyak::Xmm value = ctx.reg_alloc.UseXmm(args[3]);
+
+        code.test(handle, handle);
+        code.jz(lookup, code.T_NEAR);
+        code.movups(xword[handle + displacement], value);
+        code.L(end);
+
+        // The handle is known to be zero here, so it serves as a temporary and is cleared again on exit.
+        code.SwitchToFarCode();
+        code.L(lookup);
+        const FarCodeScratch scratch{code, displacement == 0 ? size_t(1) : size_t(2), {handle, base}};
+        const VAddr vaddr = displacement == 0 ? VAddr{base, false} : VAddr{scratch[1], true};
+        scratch.Save();
+        if (vaddr.is_scratch) {
+            code.lea(vaddr.reg, code.ptr[base + displacement]);
+        }
+        code.movups(xword[EmitVAddrLookup(code, ctx, 128, abort, vaddr, scratch[0], handle)], value);
+        code.xor_(handle.cvt32(), handle.cvt32());
+        scratch.Restore();
+        code.jmp(end, code.T_NEAR);
+        code.L(abort);
+        code.call(write_fallbacks[std::make_tuple(128, vaddr.reg.getIdx(), value.getIdx())]);
+        code.xor_(handle.cvt32(), handle.cvt32());
+        scratch.Restore();
+        code.jmp(end, code.T_NEAR);
+        code.SwitchToNearCode();
+        return;
+    }
+
+    const Xbyak::Reg64 value = ctx.reg_alloc.UseGpr(args[3]);
+
+    const auto store = [&](Xbyak::RegExp dest_ptr) {
+        switch (bitsize) {
+        case 8:
+            code.mov(code.byte[dest_ptr], value.cvt8());
+            break;
+        case 16:
+            code.mov(word[dest_ptr], value.cvt16());
+            break;
+        case 32:
+            code.mov(dword[dest_ptr], value.cvt32());
+            break;
+        case 64:
+            code.mov(qword[dest_ptr], value);
+            break;
+        }
+    };
+
+    code.test(handle, handle);
+    code.jz(lookup, code.T_NEAR);
+    store(handle + displacement);
+    code.L(end);
+
+    // The handle is known to be zero here, so it serves as a temporary and is cleared again on exit.
+    code.SwitchToFarCode();
+    code.L(lookup);
+    const FarCodeScratch scratch{code, displacement == 0 ? size_t(1) : size_t(2), {handle, base, value}};
+    const VAddr vaddr = displacement == 0 ? VAddr{base, false} : VAddr{scratch[1], true};
+    scratch.Save();
+    if (vaddr.is_scratch) {
+        code.lea(vaddr.reg, code.ptr[base + displacement]);
+    }
+    store(EmitVAddrLookup(code, ctx, bitsize, abort, vaddr, scratch[0], handle));
+    code.xor_(handle.cvt32(), handle.cvt32());
+    scratch.Restore();
+    code.jmp(end, code.T_NEAR);
+    code.L(abort);
+    code.call(write_fallbacks[std::make_tuple(bitsize, vaddr.reg.getIdx(), value.getIdx())]);
+    code.xor_(handle.cvt32(), handle.cvt32());
+    scratch.Restore();
+    code.jmp(end, code.T_NEAR);
+    code.SwitchToNearCode();
+}
+
+void A64EmitX64::EmitPagedMemoryReadPair(A64EmitContext& ctx, IR::Inst* inst, size_t esize) {
+    Xbyak::Label lookup, end;
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const Xbyak::Reg64 handle = ctx.reg_alloc.UseGpr(args[0]);
+    const Xbyak::Reg64 base = ctx.reg_alloc.UseGpr(args[1]);
+    const s32 displacement = static_cast<s32>(args[2].GetImmediateU64());
+
+    // Without a page handle the pair may straddle a page boundary, so each element is looked up separately.
+    // The element register holds its address until it is overwritten with the loaded value. The handle is
+    // known to be zero on this path, so it serves as a temporary and is cleared again on exit.
+    const auto load_element = [&](Xbyak::Reg64 element, s32 offset, Xbyak::Reg64 page_table) {
+        Xbyak::Label abort, done;
+
+        code.lea(element, code.ptr[base + offset]);
+        const auto src_ptr = EmitVAddrLookup(code, ctx, esize, abort, VAddr{element, true}, page_table, handle);
+        if (esize == 32) {
+            code.mov(element.cvt32(), dword[src_ptr]);
+        } else {
+            code.mov(element, qword[src_ptr]);
+        }
+        code.jmp(done, code.T_NEAR);
+        code.L(abort);
+        code.call(read_fallbacks[std::make_tuple(esize, element.getIdx(), element.getIdx())]);
+        if (esize == 32) {
+            // The upper half of a 32-bit callback's return value is undefined.
+            code.mov(element.cvt32(), element.cvt32());
+        }
+        code.L(done);
+    };
+
+    if (esize == 32) {
+        const Xbyak::Reg64 lower = ctx.reg_alloc.ScratchGpr();
+
+        code.test(handle, handle);
+        code.jz(lookup, code.T_NEAR);
+        code.mov(lower, qword[handle + displacement]);
+        code.L(end);
+
+        code.SwitchToFarCode();
+        code.L(lookup);
+        const FarCodeScratch scratch{code, 2, {handle, base, lower}};
+        const Xbyak::Reg64 page_table = scratch[0];
+        const Xbyak::Reg64 upper = scratch[1];
+        scratch.Save();
+        load_element(lower, displacement, page_table);
+        load_element(upper, displacement + 4, page_table);
+        code.shl(upper, 32);
+        code.or_(lower, upper);
+        code.xor_(handle.cvt32(), handle.cvt32());
+        scratch.Restore();
+        code.jmp(end, code.T_NEAR);
+        code.SwitchToNearCode();
+
+        ctx.reg_alloc.DefineValue(inst, lower);
+        return;
+    }
+
+    const Xbyak::Xmm value = ctx.reg_alloc.ScratchXmm();
+
+    code.test(handle, handle);
+    code.jz(lookup, code.T_NEAR);
+    code.movups(value, xword[handle + displacement]);
+    code.L(end);
+
+    code.SwitchToFarCode();
+    code.L(lookup);
+    const FarCodeScratch scratch{code, 3, {handle, base}};
+    const Xbyak::Reg64 page_table = scratch[0];
+    const Xbyak::Reg64 lower = scratch[1];
+    const Xbyak::Reg64 upper = scratch[2];
+    scratch.Save();
+    load_element(lower, displacement, page_table);
+    load_element(upper, displacement + 8, page_table);
+    // The two halves are combined through the stack, which needs no further registers.
+    code.push(upper);
+    code.push(lower);
+    code.movups(value, xword[code.rsp]);
+    code.add(code.rsp, 16);
+    code.xor_(handle.cvt32(), handle.cvt32());
+    scratch.Restore();
+    code.jmp(end, code.T_NEAR);
+    code.SwitchToNearCode();
+
+    ctx.reg_alloc.DefineValue(inst, value);
+}
+
+void A64EmitX64::EmitA64PagedReadMemory8(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitPagedMemoryRead(ctx, inst, 8);
+}
+
+void A64EmitX64::EmitA64PagedReadMemory16(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitPagedMemoryRead(ctx, inst, 16);
+}
+
+void A64EmitX64::EmitA64PagedReadMemory32(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitPagedMemoryRead(ctx, inst, 32);
+}
+
+void A64EmitX64::EmitA64PagedReadMemory64(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitPagedMemoryRead(ctx, inst, 64);
+}
+
+void A64EmitX64::EmitA64PagedReadMemory128(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitPagedMemoryRead(ctx, inst, 128);
+}
+
+void A64EmitX64::EmitA64PagedReadMemoryPair32(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitPagedMemoryReadPair(ctx, inst, 32);
+}
+
+void A64EmitX64::EmitA64PagedReadMemoryPair64(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitPagedMemoryReadPair(ctx, inst, 64);
+}
+
+void A64EmitX64::EmitA64PagedWriteMemory8(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitPagedMemoryWrite(ctx, inst, 8);
+}
+
+void A64EmitX64::EmitA64PagedWriteMemory16(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitPagedMemoryWrite(ctx, inst, 16);
+}
+
+void A64EmitX64::EmitA64PagedWriteMemory32(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitPagedMemoryWrite(ctx, inst, 32);
+}
+
+void A64EmitX64::EmitA64PagedWriteMemory64(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitPagedMemoryWrite(ctx, inst, 64);
+}
+
+void A64EmitX64::EmitA64PagedWriteMemory128(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitPagedMemoryWrite(ctx, inst, 128);
+}
+
 void A64EmitX64::EmitExclusiveWrite(A64EmitContext& ctx, IR::Inst* inst, size_t bitsize) {
     if (conf.global_monitor) {
         auto args = ctx.reg_alloc.GetArgumentInfo(inst);
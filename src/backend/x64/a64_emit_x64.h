@@ -75,6 +75,9 @@ protected:
 
     void EmitDirectPageTableMemoryRead(A64EmitContext& ctx, IR::Inst* inst, size_t bitsize);
     void EmitDirectPageTableMemoryWrite(A64EmitContext& ctx, IR::Inst* inst, size_t bitsize);
+    void EmitPagedMemoryRead(A64EmitContext& ctx, IR::Inst* inst, size_t bitsize);
+    void EmitPagedMemoryReadPair(A64EmitContext& ctx, IR::Inst* inst, size_t esize);
+    void EmitPagedMemoryWrite(A64EmitContext& ctx, IR::Inst* inst, size_t bitsize);
     void EmitExclusiveWrite(A64EmitContext& ctx, IR::Inst* inst, size_t bitsize);
 
     // Microinstruction emitters
@@ -200,10 +200,22 @@ private:
 
         // JIT Compile
         const auto get_code = [this](u64 vaddr) { return conf.callbacks->MemoryReadCode(vaddr); };
-        IR::Block ir_block = A64::Translate(A64::LocationDescriptor{current_location}, get_code, {conf.define_unpredictable_behaviour});
+        const bool emit_sha_instructions = block_of_code.DoesCpuSupport(Xbyak::util::Cpu::tSHA);
+        IR::Block ir_block = A64::Translate(A64::LocationDescriptor{current_location}, get_code, {conf.define_unpredictable_behaviour, true, emit_sha_instructions});
         Optimization::A64CallbackConfigPass(ir_block, conf);
         Optimization::A64GetSetElimination(ir_block);
         Optimization::ConstantPropagation(ir_block);
+        Optimization::A64ConstantMemoryReads(ir_block, conf.callbacks);
+        Optimization::RedundantExtensionElimination(ir_block);
+        Optimization::CommonSubexpressionElimination(ir_block);
+        Optimization::RedundantLoadStoreElimination(ir_block);
+        Optimization::A64FlagLiveness(ir_block);
+        Optimization::DeadCodeElimination(ir_block);
+        Optimization::A64AddressModeFolding(ir_block);
+        if (conf.reuse_page_table_lookups) {
+            Optimization::A64PageLookupReuse(ir_block, conf);
+            Optimization::A64MemoryPairMerging(ir_block);
+        }
         Optimization::DeadCodeElimination(ir_block);
         Optimization::A64MergeInterpretBlocksPass(ir_block, conf.callbacks);
         // printf("%s\n", IR::DumpBlock(ir_block).c_str());
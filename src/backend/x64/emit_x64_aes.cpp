@@ -42,20 +42,94 @@ static void EmitAESFunction(RegAlloc::ArgumentInfo args, EmitContext& ctx, Block
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
+static void DecryptSingleRoundAndInverseMixColumns(AES::State& out_state, const AES::State& state) {
+    AES::State decrypted;
+    AES::DecryptSingleRound(decrypted, state);
+    AES::InverseMixColumns(out_state, decrypted);
+}
+
+static void EncryptSingleRoundAndMixColumns(AES::State& out_state, const AES::State& state) {
+    AES::State encrypted;
+    AES::EncryptSingleRound(encrypted, state);
+    AES::MixColumns(out_state, encrypted);
+}
+
 void EmitX64::EmitAESDecryptSingleRound(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tAESNI)) {
+        const Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm zero = ctx.reg_alloc.ScratchXmm();
+
+        // AESDECLAST performs InvShiftRows, InvSubBytes and then xors in the round key.
+        // The ARM AddRoundKey step has already been performed by the caller, so use a zero round key.
+        code.pxor(zero, zero);
+        code.aesdeclast(data, zero);
+
+        ctx.reg_alloc.DefineValue(inst, data);
+        return;
+    }
+
     EmitAESFunction(args, ctx, code, inst, AES::DecryptSingleRound);
 }
 
+void EmitX64::EmitAESDecryptSingleRoundAndInverseMixColumns(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tAESNI)) {
+        const Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm zero = ctx.reg_alloc.ScratchXmm();
+
+        // AESDEC performs InvShiftRows, InvSubBytes, InvMixColumns and then xors in the round key.
+        code.pxor(zero, zero);
+        code.aesdec(data, zero);
+
+        ctx.reg_alloc.DefineValue(inst, data);
+        return;
+    }
+
+    EmitAESFunction(args, ctx, code, inst, DecryptSingleRoundAndInverseMixColumns);
+}
+
 void EmitX64::EmitAESEncryptSingleRound(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tAESNI)) {
+        const Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm zero = ctx.reg_alloc.ScratchXmm();
+
+        // AESENCLAST performs ShiftRows, SubBytes and then xors in the round key.
+        // The ARM AddRoundKey step has already been performed by the caller, so use a zero round key.
+        code.pxor(zero, zero);
+        code.aesenclast(data, zero);
+
+        ctx.reg_alloc.DefineValue(inst, data);
+        return;
+    }
+
     EmitAESFunction(args, ctx, code, inst, AES::EncryptSingleRound);
 }
 
+void EmitX64::EmitAESEncryptSingleRoundAndMixColumns(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tAESNI)) {
+        const Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm zero = ctx.reg_alloc.ScratchXmm();
+
+        // AESENC performs ShiftRows, SubBytes, MixColumns and then xors in the round key.
+        code.pxor(zero, zero);
+        code.aesenc(data, zero);
+
+        ctx.reg_alloc.DefineValue(inst, data);
+        return;
+    }
+
+    EmitAESFunction(args, ctx, code, inst, EncryptSingleRoundAndMixColumns);
+}
+
 void EmitX64::EmitAESInverseMixColumns(EmitContext& ctx, IR::Inst* inst) {
-     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
     if (code.DoesCpuSupport(Xbyak::util::Cpu::tAESNI)) {
         const Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
@@ -70,6 +144,21 @@ void EmitX64::EmitAESInverseMixColumns(EmitContext& ctx, IR::Inst* inst) {
 
 void EmitX64::EmitAESMixColumns(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tAESNI)) {
+        const Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm zero = ctx.reg_alloc.ScratchXmm();
+
+        // x86 has no standalone MixColumns instruction.
+        // AESDECLAST undoes ShiftRows and SubBytes; AESENC then redoes them before applying MixColumns.
+        code.pxor(zero, zero);
+        code.aesdeclast(data, zero);
+        code.aesenc(data, zero);
+
+        ctx.reg_alloc.DefineValue(inst, data);
+        return;
+    }
+
     EmitAESFunction(args, ctx, code, inst, AES::MixColumns);
 }
 
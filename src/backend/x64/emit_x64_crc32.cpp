@@ -9,6 +9,7 @@
 
 #include "backend/x64/block_of_code.h"
 #include "backend/x64/emit_x64.h"
+#include "common/assert.h"
 #include "common/crypto/crc32.h"
 #include "frontend/ir/microinstruction.h"
 
@@ -32,9 +33,60 @@ static void EmitCRC32Castagnoli(BlockOfCode& code, EmitContext& ctx, IR::Inst* i
     }
 }
 
+// Computes the CRC of the 32-bit value in crc (with a zero initial CRC) using Barrett reduction.
+// constants must contain the bit-reflected values of floor(x^64 / P) and P in its low and high quadwords.
+static void EmitCRC32ISOBarrettReduction(BlockOfCode& code, Xbyak::Reg32 crc, Xbyak::Xmm tmp, Xbyak::Address constants) {
+    code.movd(tmp, crc);
+    code.pclmulqdq(tmp, constants, 0x00);
+    // Only the low 32 bits of the quotient are required; shifting them up also places the final remainder in bits 95:64.
+    code.psllq(tmp, 32);
+    code.pclmulqdq(tmp, constants, 0x10);
+    code.psrldq(tmp, 8);
+    code.movd(crc, tmp);
+}
+
 static void EmitCRC32ISO(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, const int data_size) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tPCLMULQDQ)) {
+        const Xbyak::Reg32 crc = ctx.reg_alloc.UseScratchGpr(args[0]).cvt32();
+        const Xbyak::Reg64 value = ctx.reg_alloc.UseScratchGpr(args[1]);
+        const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+        const Xbyak::Address constants = code.MConst(xword, 0x00000001F7011641, 0x00000001DB710641);
+
+        switch (data_size) {
+        case 8:
+        case 16: {
+            // Feeding leading zero bits into a reflected CRC with a zero initial value has no effect,
+            // so the data can be processed as a 32-bit value with the data in its upper bits.
+            const Xbyak::Reg32 data = ctx.reg_alloc.ScratchGpr().cvt32();
+            code.mov(data, crc);
+            code.xor_(data, value.cvt32());
+            code.shl(data, 32 - data_size);
+            code.shr(crc, data_size);
+            EmitCRC32ISOBarrettReduction(code, data, tmp, constants);
+            code.xor_(crc, data);
+            break;
+        }
+        case 32:
+            code.xor_(crc, value.cvt32());
+            EmitCRC32ISOBarrettReduction(code, crc, tmp, constants);
+            break;
+        case 64:
+            code.xor_(crc, value.cvt32());
+            code.shr(value, 32);
+            EmitCRC32ISOBarrettReduction(code, crc, tmp, constants);
+            code.xor_(crc, value.cvt32());
+            EmitCRC32ISOBarrettReduction(code, crc, tmp, constants);
+            break;
+        default:
+            UNREACHABLE();
+        }
+
+        ctx.reg_alloc.DefineValue(inst, crc);
+        return;
+    }
+
     ctx.reg_alloc.HostCall(inst, args[0], args[1], {});
     code.mov(code.ABI_PARAM3, data_size / CHAR_BIT);
     code.CallFunction(&CRC32::ComputeCRC32ISO);
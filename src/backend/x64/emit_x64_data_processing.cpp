@@ -7,6 +7,7 @@
 #include "backend/x64/block_of_code.h"
 #include "backend/x64/emit_x64.h"
 #include "common/assert.h"
+#include "common/bit_util.h"
 #include "common/common_types.h"
 #include "frontend/ir/basic_block.h"
 #include "frontend/ir/microinstruction.h"
@@ -219,6 +220,214 @@ void EmitX64::EmitExtractRegister64(Dynarmic::BackendX64::EmitContext& ctx, IR::
     EmitExtractRegister(code, ctx, inst, 64);
 }
 
+static void EmitUnsignedBitFieldExtract(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, int bitsize) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const u8 lsb = args[1].GetImmediateU8();
+    const u8 width = args[2].GetImmediateU8();
+    ASSERT(width != 0 && lsb + width <= bitsize);
+
+    if (lsb + width == bitsize) {
+        const Xbyak::Reg result = ctx.reg_alloc.UseScratchGpr(args[0]).changeBit(bitsize);
+
+        code.shr(result, lsb);
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    if (lsb == 0 && width <= 32) {
+        const Xbyak::Reg64 result = ctx.reg_alloc.UseScratchGpr(args[0]);
+
+        // Writes to a 32-bit register zero the upper half, so the masks can always be 32-bit.
+        switch (width) {
+        case 8:
+            code.movzx(result.cvt32(), result.cvt8());
+            break;
+        case 16:
+            code.movzx(result.cvt32(), result.cvt16());
+            break;
+        case 32:
+            code.mov(result.cvt32(), result.cvt32());
+            break;
+        default:
+            code.and_(result.cvt32(), Common::Ones<u32>(width));
+            break;
+        }
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tBMI1)) {
+        const Xbyak::Reg source = ctx.reg_alloc.UseGpr(args[0]).changeBit(bitsize);
+        const Xbyak::Reg64 result = ctx.reg_alloc.ScratchGpr();
+        const Xbyak::Reg64 control = ctx.reg_alloc.ScratchGpr();
+
+        code.mov(control.cvt32(), (width << 8) | lsb);
+        if (bitsize == 32) {
+            code.bextr(result.cvt32(), source, control.cvt32());
+        } else {
+            code.bextr(result, source, control);
+        }
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    const Xbyak::Reg result = ctx.reg_alloc.UseScratchGpr(args[0]).changeBit(bitsize);
+
+    code.shl(result, bitsize - lsb - width);
+    code.shr(result, bitsize - width);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitUnsignedBitFieldExtract32(EmitContext& ctx, IR::Inst* inst) {
+    EmitUnsignedBitFieldExtract(code, ctx, inst, 32);
+}
+
+void EmitX64::EmitUnsignedBitFieldExtract64(EmitContext& ctx, IR::Inst* inst) {
+    EmitUnsignedBitFieldExtract(code, ctx, inst, 64);
+}
+
+static void EmitSignedBitFieldExtract(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, int bitsize) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const u8 lsb = args[1].GetImmediateU8();
+    const u8 width = args[2].GetImmediateU8();
+    ASSERT(width != 0 && lsb + width <= bitsize);
+
+    if (lsb == 0 && (width == 8 || width == 16 || (width == 32 && bitsize == 64))) {
+        const Xbyak::Reg64 source = ctx.reg_alloc.UseGpr(args[0]);
+        const Xbyak::Reg result = ctx.reg_alloc.ScratchGpr().changeBit(bitsize);
+
+        switch (width) {
+        case 8:
+            code.movsx(result, source.cvt8());
+            break;
+        case 16:
+            code.movsx(result, source.cvt16());
+            break;
+        default:
+            code.movsxd(result.cvt64(), source.cvt32());
+            break;
+        }
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    const Xbyak::Reg result = ctx.reg_alloc.UseScratchGpr(args[0]).changeBit(bitsize);
+
+    if (lsb + width != bitsize) {
+        code.shl(result, bitsize - lsb - width);
+    }
+    code.sar(result, bitsize - width);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitSignedBitFieldExtract32(EmitContext& ctx, IR::Inst* inst) {
+    EmitSignedBitFieldExtract(code, ctx, inst, 32);
+}
+
+void EmitX64::EmitSignedBitFieldExtract64(EmitContext& ctx, IR::Inst* inst) {
+    EmitSignedBitFieldExtract(code, ctx, inst, 64);
+}
+
+static void EmitBitFieldInsert(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, int bitsize) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const u8 lsb = args[2].GetImmediateU8();
+    const u8 width = args[3].GetImmediateU8();
+    ASSERT(width != 0 && lsb + width <= bitsize);
+
+    if (width == bitsize) {
+        ctx.reg_alloc.DefineValue(inst, args[1]);
+        return;
+    }
+
+    const u64 field_mask = Common::Ones<u64>(width) << lsb;
+    const u64 keep_mask = ~field_mask & Common::Ones<u64>(bitsize);
+    const bool keep_mask_is_imm32 = bitsize == 32 || static_cast<s64>(keep_mask) == static_cast<s32>(keep_mask);
+
+    // Moves the inserted bits into place, discarding the source bits outside of the field.
+    const auto position_field = [&](const Xbyak::Reg& field) {
+        if (lsb + width == bitsize) {
+            code.shl(field, lsb);
+        } else {
+            code.shl(field, bitsize - width);
+            code.shr(field, bitsize - width - lsb);
+        }
+    };
+
+    if (keep_mask_is_imm32) {
+        const Xbyak::Reg field = ctx.reg_alloc.UseScratchGpr(args[1]).changeBit(bitsize);
+        const Xbyak::Reg result = ctx.reg_alloc.UseScratchGpr(args[0]).changeBit(bitsize);
+
+        position_field(field);
+        code.and_(result, static_cast<u32>(keep_mask));
+        code.or_(result, field);
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    // The remaining masks need a register. ANDN clears the field without also requiring a copy of the destination.
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tBMI1)) {
+        const Xbyak::Reg64 field = ctx.reg_alloc.UseScratchGpr(args[1]);
+        const Xbyak::Reg64 destination = ctx.reg_alloc.UseGpr(args[0]);
+        const Xbyak::Reg64 result = ctx.reg_alloc.ScratchGpr();
+
+        position_field(field);
+        code.mov(result, field_mask);
+        code.andn(result, result, destination);
+        code.or_(result, field);
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    const Xbyak::Reg64 field = ctx.reg_alloc.UseScratchGpr(args[1]);
+    const Xbyak::Reg64 result = ctx.reg_alloc.UseScratchGpr(args[0]);
+    const Xbyak::Reg64 mask = ctx.reg_alloc.ScratchGpr();
+
+    position_field(field);
+    code.mov(mask, keep_mask);
+    code.and_(result, mask);
+    code.or_(result, field);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitBitFieldInsert32(EmitContext& ctx, IR::Inst* inst) {
+    EmitBitFieldInsert(code, ctx, inst, 32);
+}
+
+void EmitX64::EmitBitFieldInsert64(EmitContext& ctx, IR::Inst* inst) {
+    EmitBitFieldInsert(code, ctx, inst, 64);
+}
+
+using ShiftByRegisterFn = void (Xbyak::CodeGenerator::*)(const Xbyak::Reg32e&, const Xbyak::Operand&, const Xbyak::Reg32e&);
+
+// SHLX and SHRX take their shift count in any register rather than in CL, and do not destroy their operand.
+// Like SHL and SHR they mask the count, so counts of at least bitsize are fixed up afterwards to produce zero.
+static void EmitLogicalShiftByRegisterBMI2(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Argument& operand_arg, Argument& shift_arg, int bitsize, ShiftByRegisterFn fn) {
+    const Xbyak::Reg64 shift = ctx.reg_alloc.UseGpr(shift_arg);
+    const Xbyak::Reg64 operand = ctx.reg_alloc.UseGpr(operand_arg);
+    const Xbyak::Reg64 result = ctx.reg_alloc.ScratchGpr();
+    const Xbyak::Reg64 zero = ctx.reg_alloc.ScratchGpr();
+
+    if (bitsize == 32) {
+        (code.*fn)(result.cvt32(), operand.cvt32(), shift.cvt32());
+    } else {
+        (code.*fn)(result, operand, shift);
+    }
+    code.xor_(zero.cvt32(), zero.cvt32());
+    code.cmp(shift.cvt8(), bitsize);
+    code.cmovnb(result, zero);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
 void EmitX64::EmitLogicalShiftLeft32(EmitContext& ctx, IR::Inst* inst) {
     const auto carry_inst = inst->GetAssociatedPseudoOperation(IR::Opcode::GetCarryFromOp);
 
@@ -227,8 +436,6 @@ void EmitX64::EmitLogicalShiftLeft32(EmitContext& ctx, IR::Inst* inst) {
     auto& shift_arg = args[1];
     auto& carry_arg = args[2];
 
-    // TODO: Consider using BMI2 instructions like SHLX when arm-in-host flags is implemented.
-
     if (!carry_inst) {
         if (shift_arg.IsImmediate()) {
             const Xbyak::Reg32 result = ctx.reg_alloc.UseScratchGpr(operand_arg).cvt32();
@@ -241,6 +448,8 @@ void EmitX64::EmitLogicalShiftLeft32(EmitContext& ctx, IR::Inst* inst) {
             }
 
             ctx.reg_alloc.DefineValue(inst, result);
+        } else if (code.DoesCpuSupport(Xbyak::util::Cpu::tBMI2)) {
+            EmitLogicalShiftByRegisterBMI2(code, ctx, inst, operand_arg, shift_arg, 32, &Xbyak::CodeGenerator::shlx);
         } else {
             ctx.reg_alloc.Use(shift_arg, HostLoc::RCX);
             const Xbyak::Reg32 result = ctx.reg_alloc.UseScratchGpr(operand_arg).cvt32();
@@ -335,6 +544,8 @@ void EmitX64::EmitLogicalShiftLeft64(EmitContext& ctx, IR::Inst* inst) {
         }
 
         ctx.reg_alloc.DefineValue(inst, result);
+    } else if (code.DoesCpuSupport(Xbyak::util::Cpu::tBMI2)) {
+        EmitLogicalShiftByRegisterBMI2(code, ctx, inst, operand_arg, shift_arg, 64, &Xbyak::CodeGenerator::shlx);
     } else {
         ctx.reg_alloc.Use(shift_arg, HostLoc::RCX);
         const Xbyak::Reg64 result = ctx.reg_alloc.UseScratchGpr(operand_arg);
@@ -372,6 +583,8 @@ void EmitX64::EmitLogicalShiftRight32(EmitContext& ctx, IR::Inst* inst) {
             }
 
             ctx.reg_alloc.DefineValue(inst, result);
+        } else if (code.DoesCpuSupport(Xbyak::util::Cpu::tBMI2)) {
+            EmitLogicalShiftByRegisterBMI2(code, ctx, inst, operand_arg, shift_arg, 32, &Xbyak::CodeGenerator::shrx);
         } else {
             ctx.reg_alloc.Use(shift_arg, HostLoc::RCX);
             const Xbyak::Reg32 result = ctx.reg_alloc.UseScratchGpr(operand_arg).cvt32();
@@ -467,6 +680,8 @@ void EmitX64::EmitLogicalShiftRight64(EmitContext& ctx, IR::Inst* inst) {
         }
 
         ctx.reg_alloc.DefineValue(inst, result);
+    } else if (code.DoesCpuSupport(Xbyak::util::Cpu::tBMI2)) {
+        EmitLogicalShiftByRegisterBMI2(code, ctx, inst, operand_arg, shift_arg, 64, &Xbyak::CodeGenerator::shrx);
     } else {
         ctx.reg_alloc.Use(shift_arg, HostLoc::RCX);
         const Xbyak::Reg64 result = ctx.reg_alloc.UseScratchGpr(operand_arg);
@@ -499,6 +714,20 @@ void EmitX64::EmitArithmeticShiftRight32(EmitContext& ctx, IR::Inst* inst) {
 
             code.sar(result, u8(shift < 31 ? shift : 31));
 
+            ctx.reg_alloc.DefineValue(inst, result);
+        } else if (code.DoesCpuSupport(Xbyak::util::Cpu::tBMI2)) {
+            const Xbyak::Reg32 shift = ctx.reg_alloc.UseScratchGpr(shift_arg).cvt32();
+            const Xbyak::Reg32 operand = ctx.reg_alloc.UseGpr(operand_arg).cvt32();
+            const Xbyak::Reg32 result = ctx.reg_alloc.ScratchGpr().cvt32();
+            const Xbyak::Reg32 const31 = ctx.reg_alloc.ScratchGpr().cvt32();
+
+            // SARX masks the count in the same way as SAR, so it is saturated to 31 as below.
+            code.mov(const31, 31);
+            code.movzx(shift, shift.cvt8());
+            code.cmp(shift, u32(31));
+            code.cmovg(shift, const31);
+            code.sarx(result, operand, shift);
+
             ctx.reg_alloc.DefineValue(inst, result);
         } else {
             ctx.reg_alloc.UseScratch(shift_arg, HostLoc::RCX);
@@ -583,6 +812,20 @@ void EmitX64::EmitArithmeticShiftRight64(EmitContext& ctx, IR::Inst* inst) {
 
         code.sar(result, u8(shift < 63 ? shift : 63));
 
+        ctx.reg_alloc.DefineValue(inst, result);
+    } else if (code.DoesCpuSupport(Xbyak::util::Cpu::tBMI2)) {
+        const Xbyak::Reg64 shift = ctx.reg_alloc.UseScratchGpr(shift_arg);
+        const Xbyak::Reg64 operand = ctx.reg_alloc.UseGpr(operand_arg);
+        const Xbyak::Reg64 result = ctx.reg_alloc.ScratchGpr();
+        const Xbyak::Reg64 const63 = ctx.reg_alloc.ScratchGpr();
+
+        // SARX masks the count in the same way as SAR, so it is saturated to 63 as below.
+        code.mov(const63.cvt32(), 63);
+        code.movzx(shift.cvt32(), shift.cvt8());
+        code.cmp(shift.cvt32(), u32(63));
+        code.cmovg(shift.cvt32(), const63.cvt32());
+        code.sarx(result, operand, shift);
+
         ctx.reg_alloc.DefineValue(inst, result);
     } else {
         ctx.reg_alloc.UseScratch(shift_arg, HostLoc::RCX);
@@ -612,7 +855,15 @@ void EmitX64::EmitRotateRight32(EmitContext& ctx, IR::Inst* inst) {
     auto& carry_arg = args[2];
 
     if (!carry_inst) {
-        if (shift_arg.IsImmediate()) {
+        if (shift_arg.IsImmediate() && code.DoesCpuSupport(Xbyak::util::Cpu::tBMI2)) {
+            const u8 shift = shift_arg.GetImmediateU8();
+            const Xbyak::Reg32 operand = ctx.reg_alloc.UseGpr(operand_arg).cvt32();
+            const Xbyak::Reg32 result = ctx.reg_alloc.ScratchGpr().cvt32();
+
+            code.rorx(result, operand, u8(shift & 0x1F));
+
+            ctx.reg_alloc.DefineValue(inst, result);
+        } else if (shift_arg.IsImmediate()) {
             const u8 shift = shift_arg.GetImmediateU8();
             const Xbyak::Reg32 result = ctx.reg_alloc.UseScratchGpr(operand_arg).cvt32();
 
@@ -687,7 +938,15 @@ void EmitX64::EmitRotateRight64(EmitContext& ctx, IR::Inst* inst) {
     auto& operand_arg = args[0];
     auto& shift_arg = args[1];
 
-    if (shift_arg.IsImmediate()) {
+    if (shift_arg.IsImmediate() && code.DoesCpuSupport(Xbyak::util::Cpu::tBMI2)) {
+        const u8 shift = shift_arg.GetImmediateU8();
+        const Xbyak::Reg64 operand = ctx.reg_alloc.UseGpr(operand_arg);
+        const Xbyak::Reg64 result = ctx.reg_alloc.ScratchGpr();
+
+        code.rorx(result, operand, u8(shift & 0x3F));
+
+        ctx.reg_alloc.DefineValue(inst, result);
+    } else if (shift_arg.IsImmediate()) {
         const u8 shift = shift_arg.GetImmediateU8();
         const Xbyak::Reg64 result = ctx.reg_alloc.UseScratchGpr(operand_arg);
 
@@ -871,7 +1130,12 @@ static void EmitSub(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, int bit
         ctx.EraseInstruction(nzcv_inst);
     }
     if (carry_inst) {
-        code.setnc(carry);
+        // The host carry has already been inverted above if NZCV was requested.
+        if (nzcv_inst) {
+            code.setc(carry);
+        } else {
+            code.setnc(carry);
+        }
         ctx.reg_alloc.DefineValue(carry_inst, carry);
         ctx.EraseInstruction(carry_inst);
     }
@@ -921,6 +1185,17 @@ void EmitX64::EmitMul64(EmitContext& ctx, IR::Inst* inst) {
 void EmitX64::EmitUnsignedMultiplyHigh64(EmitContext& ctx, IR::Inst* inst) {
    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
+   if (code.DoesCpuSupport(Xbyak::util::Cpu::tBMI2)) {
+       // MULX leaves RAX and the flags alone. Naming the same destination twice keeps only the high half.
+       ctx.reg_alloc.Use(args[0], HostLoc::RDX);
+       const Xbyak::Reg64 result = ctx.reg_alloc.ScratchGpr();
+       OpArg op_arg = ctx.reg_alloc.UseOpArg(args[1]);
+       code.mulx(result, result, *op_arg);
+
+       ctx.reg_alloc.DefineValue(inst, result);
+       return;
+   }
+
    ctx.reg_alloc.ScratchGpr({HostLoc::RDX});
    ctx.reg_alloc.UseScratch(args[0], HostLoc::RAX);
    OpArg op_arg = ctx.reg_alloc.UseOpArg(args[1]);
@@ -18,6 +18,7 @@
 #include "common/fp/info.h"
 #include "common/fp/op.h"
 #include "common/fp/rounding_mode.h"
+#include "common/math_util.h"
 #include "common/mp/cartesian_product.h"
 #include "common/mp/integer.h"
 #include "common/mp/list.h"
@@ -39,16 +40,22 @@ const Xbyak::Reg64 INVALID_REG = Xbyak::Reg64(-1);
 
 constexpr u64 f16_negative_zero = 0x8000;
 constexpr u64 f16_non_sign_mask = 0x7fff;
+constexpr u64 f16_positive_infinity = 0x7c00;
+constexpr u64 f16_smallest_normal = 0x0400;
 
 constexpr u64 f32_negative_zero = 0x80000000u;
 constexpr u64 f32_nan = 0x7fc00000u;
 constexpr u64 f32_non_sign_mask = 0x7fffffffu;
 constexpr u64 f32_smallest_normal = 0x00800000u;
+constexpr u64 f32_integral_lim = 0x4b000000u; // 2^23 as a float (all values of at least this magnitude are integers)
 
 constexpr u64 f64_negative_zero = 0x8000000000000000u;
 constexpr u64 f64_nan = 0x7ff8000000000000u;
 constexpr u64 f64_non_sign_mask = 0x7fffffffffffffffu;
 constexpr u64 f64_smallest_normal = 0x0010000000000000u;
+constexpr u64 f64_integral_lim = 0x4330000000000000u; // 2^52 as a double (all values of at least this magnitude are integers)
+constexpr u64 f64_round_to_odd_mask = 0xffffffffe0000000u; // Bits of a double kept when truncating it to single precision
+constexpr u64 f64_round_to_odd_bit = 0x0000000020000000u; // Lowest bit of a double kept when truncating it to single precision
 
 constexpr u64 f64_max_s32 = 0x41dfffffffc00000u; // 2147483647 as a double
 constexpr u64 f64_min_u32 = 0x0000000000000000u; // 0 as a double
@@ -586,7 +593,76 @@ template<size_t fsize>
 static void EmitFPMulAdd(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
     using FPT = mp::unsigned_integer_of_size<fsize>;
 
-    if constexpr (fsize != 16) {
+    if constexpr (fsize == 16) {
+        if (code.DoesCpuSupport(Xbyak::util::Cpu::tF16C) && !ctx.FPCR().FZ16()) {
+            auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+            Xbyak::Label end, fallback;
+
+            const Xbyak::Xmm operand1 = ctx.reg_alloc.UseXmm(args[0]);
+            const Xbyak::Xmm operand2 = ctx.reg_alloc.UseXmm(args[1]);
+            const Xbyak::Xmm operand3 = ctx.reg_alloc.UseXmm(args[2]);
+            const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+            const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+            const Xbyak::Reg32 abs_result = ctx.reg_alloc.ScratchGpr().cvt32();
+
+            // The product of two half-precision values is exact in double precision, so the sum is the only rounding.
+            // Rounding the sum to single precision with round-to-odd (truncating, then setting the lowest bit if any
+            // discarded bits were set) allows vcvtps2ph to then correctly round it to half precision.
+            code.vcvtph2ps(result, operand2);
+            code.vcvtps2pd(result, result);
+            code.vcvtph2ps(tmp, operand3);
+            code.vcvtps2pd(tmp, tmp);
+            code.vmulsd(result, result, tmp);
+            code.vcvtph2ps(tmp, operand1);
+            code.vcvtps2pd(tmp, tmp);
+            code.vaddsd(result, result, tmp);
+
+            code.vandpd(tmp, result, code.MConst(xword, f64_round_to_odd_mask));
+            code.vcmpneqsd(result, result, tmp);
+            code.vandpd(result, result, code.MConst(xword, f64_round_to_odd_bit));
+            code.vorpd(result, result, tmp);
+            code.vcvtpd2ps(result, result);
+            code.vcvtps2ph(result, result, 0b100);
+
+            code.vmovd(abs_result, result);
+            code.and_(abs_result, f16_non_sign_mask);
+            code.cmp(abs_result, f16_smallest_normal);
+            code.je(fallback, code.T_NEAR);
+            code.cmp(abs_result, f16_positive_infinity);
+            code.ja(fallback, code.T_NEAR);
+            code.L(end);
+
+            code.SwitchToFarCode();
+            code.L(fallback);
+
+            code.sub(rsp, 8);
+            ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+            code.vpextrw(code.ABI_PARAM1.cvt32(), operand1, 0);
+            code.vpextrw(code.ABI_PARAM2.cvt32(), operand2, 0);
+            code.vpextrw(code.ABI_PARAM3.cvt32(), operand3, 0);
+            code.mov(code.ABI_PARAM4.cvt32(), ctx.FPCR().Value());
+#ifdef _WIN32
+            code.sub(rsp, 16 + ABI_SHADOW_SPACE);
+            code.lea(rax, code.ptr[code.r15 + code.GetJitStateInfo().offsetof_fpsr_exc]);
+            code.mov(qword[rsp + ABI_SHADOW_SPACE], rax);
+            code.CallFunction(&FP::FPMulAdd<FPT>);
+            code.add(rsp, 16 + ABI_SHADOW_SPACE);
+#else
+            code.lea(code.ABI_PARAM5, code.ptr[code.r15 + code.GetJitStateInfo().offsetof_fpsr_exc]);
+            code.CallFunction(&FP::FPMulAdd<FPT>);
+#endif
+            code.movq(result, code.ABI_RETURN);
+            ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+            code.add(rsp, 8);
+
+            code.jmp(end, code.T_NEAR);
+            code.SwitchToNearCode();
+
+            ctx.reg_alloc.DefineValue(inst, result);
+            return;
+        }
+    } else {
         if (code.DoesCpuSupport(Xbyak::util::Cpu::tFMA)) {
             auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
@@ -610,6 +686,19 @@ static void EmitFPMulAdd(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
             code.SwitchToFarCode();
             code.L(fallback);
 
+            if (ctx.FPCR().DN()) {
+                // A NaN result only needs to be replaced with the default NaN, unless the addend is a NaN:
+                // (inf * 0) + qNaN must signal Invalid Operation, which x86 does not do.
+                Xbyak::Label call;
+                FCODE(ucomis)(result, result);
+                code.jnp(call);
+                FCODE(ucomis)(operand1, operand1);
+                code.jp(call);
+                code.movaps(result, code.MConst(xword, fsize == 32 ? f32_nan : f64_nan));
+                code.jmp(end, code.T_NEAR);
+                code.L(call);
+            }
+
             code.sub(rsp, 8);
             ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
             code.movq(code.ABI_PARAM1, operand1);
@@ -723,8 +812,73 @@ void EmitX64::EmitFPMulX64(EmitContext& ctx, IR::Inst* inst) {
     EmitFPMulX<64>(code, ctx, inst);
 }
 
+/// Calls fn(operand, fpcr, fpsr) from far code for inputs the inline estimate paths do not handle.
+template<typename FPT>
+static void EmitFPEstimateFallback(BlockOfCode& code, EmitContext& ctx, FPT (*fn)(FPT, FP::FPCR, FP::FPSR&), Xbyak::Reg64 result, Xbyak::Reg64 operand) {
+    constexpr int fsize = static_cast<int>(FP::FPInfo<FPT>::total_width);
+
+    code.sub(rsp, 8);
+    ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocRegIdx(result.getIdx()));
+    code.mov(code.ABI_PARAM1, operand);
+    code.mov(code.ABI_PARAM2.cvt32(), ctx.FPCR().Value());
+    code.lea(code.ABI_PARAM3, code.ptr[code.r15 + code.GetJitStateInfo().offsetof_fpsr_exc]);
+    code.CallFunction(fn);
+    code.mov(result.changeBit(fsize), code.ABI_RETURN.changeBit(fsize));
+    ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocRegIdx(result.getIdx()));
+    code.add(rsp, 8);
+}
+
 template<typename FPT>
 static void EmitFPRecipEstimate(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    if constexpr (!std::is_same_v<FPT, u16>) {
+        constexpr int fsize = static_cast<int>(FP::FPInfo<FPT>::total_width);
+        constexpr int mantissa_width = static_cast<int>(FP::FPInfo<FPT>::explicit_mantissa_width);
+        constexpr u32 bias = static_cast<u32>(FP::FPInfo<FPT>::exponent_bias);
+
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+        Xbyak::Label end, fallback;
+
+        const Xbyak::Reg64 operand = ctx.reg_alloc.UseGpr(args[0]);
+        const Xbyak::Reg64 result = ctx.reg_alloc.ScratchGpr();
+        const Xbyak::Reg64 exponent = ctx.reg_alloc.ScratchGpr();
+        const Xbyak::Reg64 table = ctx.reg_alloc.ScratchGpr();
+
+        // Normal inputs with a normal reciprocal are a table lookup on the top eight bits of the
+        // mantissa; the result exponent is 2 * bias - 1 - exponent. Everything else is handled out of line.
+        code.mov(exponent.changeBit(fsize), operand.changeBit(fsize));
+        code.shr(exponent.changeBit(fsize), mantissa_width);
+        code.and_(exponent.cvt32(), 2 * bias + 1);
+        code.lea(result.cvt32(), code.ptr[exponent - 1]);
+        code.cmp(result.cvt32(), 2 * bias - 3);
+        code.ja(fallback, code.T_NEAR);
+
+        code.mov(result.changeBit(fsize), operand.changeBit(fsize));
+        code.shr(result.changeBit(fsize), mantissa_width - 8);
+        code.movzx(result.cvt32(), result.cvt8());
+        code.mov(table, reinterpret_cast<u64>(Common::RecipEstimateTable().data()));
+        code.mov(result.cvt32(), code.dword[table + result * 4]);
+        code.shl(result, mantissa_width - 8);
+        code.neg(exponent);
+        code.add(exponent, 2 * bias - 1);
+        code.shl(exponent, mantissa_width);
+        code.or_(result, exponent);
+        code.mov(exponent.changeBit(fsize), operand.changeBit(fsize));
+        code.shr(exponent.changeBit(fsize), fsize - 1);
+        code.shl(exponent, fsize - 1);
+        code.or_(result, exponent);
+        code.L(end);
+
+        code.SwitchToFarCode();
+        code.L(fallback);
+        EmitFPEstimateFallback<FPT>(code, ctx, &FP::FPRecipEstimate<FPT>, result, operand);
+        code.jmp(end, code.T_NEAR);
+        code.SwitchToNearCode();
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     ctx.reg_alloc.HostCall(inst, args[0]);
     code.mov(code.ABI_PARAM2.cvt32(), ctx.FPCR().Value());
@@ -826,22 +980,88 @@ void EmitX64::EmitFPRecipStepFused64(EmitContext& ctx, IR::Inst* inst) {
     EmitFPRecipStepFused<64>(code, ctx, inst);
 }
 
+template<size_t fsize>
+static void EmitFPRoundInline(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, FP::RoundingMode rounding_mode, bool exact) {
+    // Bit 3 of the immediate suppresses the precision exception, which is reported as FPSR.IXC.
+    const u8 inexact_imm = exact ? 0b0000 : 0b1000;
+
+    if (const auto round_imm = ConvertRoundingModeToX64Immediate(rounding_mode)) {
+        FPTwoOp<fsize>(code, ctx, inst, [&](Xbyak::Xmm result) {
+            FCODE(rounds)(result, result, static_cast<u8>(*round_imm | inexact_imm));
+        });
+        return;
+    }
+
+    ASSERT(rounding_mode == FP::RoundingMode::ToNearest_TieAwayFromZero);
+
+    FPTwoOp<fsize>(code, ctx, inst, [&](Xbyak::Xmm result) {
+        const Xbyak::Xmm truncated = ctx.reg_alloc.ScratchXmm();
+        const Xbyak::Xmm mask = ctx.reg_alloc.ScratchXmm();
+        const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+        // Any input that is not an integer is inexact, so the precision exception is only taken from this rounding.
+        FCODE(rounds)(truncated, result, static_cast<u8>(0b11 | inexact_imm));
+
+        // Values with no fractional part (including infinities and NaNs) are masked out, as inf - inf would raise
+        // a spurious invalid operation exception. The comparison is done on integers so it raises no exceptions.
+        code.movaps(tmp, result);
+        code.andps(tmp, code.MConst(xword, fsize == 32 ? f32_non_sign_mask : f64_non_sign_mask));
+        code.movaps(mask, code.MConst(xword, fsize == 32 ? f32_integral_lim : f64_integral_lim));
+        code.pcmpgtd(mask, tmp);
+        if constexpr (fsize == 64) {
+            code.pshufd(mask, mask, 0b11110101);
+        }
+        code.andps(result, mask);
+        code.andps(mask, truncated);
+
+        // The negated discarded fraction is computed exactly and lies within (-1, 1). Doubling and truncating it
+        // produces the adjustment away from zero required for fractions of at least one half. Subtracting (rather than
+        // adding) the adjustment preserves the sign of negative zero results.
+        FCODE(subs)(mask, result);
+        FCODE(adds)(mask, mask);
+        FCODE(rounds)(mask, mask, static_cast<u8>(0b1011));
+        code.movaps(result, truncated);
+        FCODE(subs)(result, mask);
+    });
+}
+
+/// Half-precision values are rounded in single precision: widening is exact, and narrowing an integral value is exact.
+static void EmitFPRoundInlineHalf(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, int round_imm, bool exact) {
+    // Bit 3 of the immediate suppresses the precision exception, which is reported as FPSR.IXC.
+    const u8 inexact_imm = exact ? 0b0000 : 0b1000;
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
+
+    // Widening quiets a signalling NaN (raising the invalid operation exception) and keeps its payload,
+    // so narrowing it again produces the same NaN as FPProcessNaN.
+    code.vcvtph2ps(result, result);
+    code.vroundss(result, result, result, static_cast<u8>(round_imm | inexact_imm));
+    if (ctx.FPCR().DN()) {
+        ForceToDefaultNaN<32>(code, result);
+    }
+    code.vcvtps2ph(result, result, 0b100);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
 static void EmitFPRound(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, size_t fsize) {
     const auto rounding_mode = static_cast<FP::RoundingMode>(inst->GetArg(1).GetU8());
     const bool exact = inst->GetArg(2).GetU1();
-    const auto round_imm = ConvertRoundingModeToX64Immediate(rounding_mode);
 
-    if (fsize != 16 && code.DoesCpuSupport(Xbyak::util::Cpu::tSSE41) && round_imm && !exact) {
+    if (fsize == 16 && code.DoesCpuSupport(Xbyak::util::Cpu::tF16C) && !ctx.FPCR().FZ16()) {
+        if (const auto round_imm = ConvertRoundingModeToX64Immediate(rounding_mode)) {
+            EmitFPRoundInlineHalf(code, ctx, inst, *round_imm, exact);
+            return;
+        }
+    }
+
+    if (fsize != 16 && code.DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
         if (fsize == 64) {
-            FPTwoOp<64>(code, ctx, inst, [&](Xbyak::Xmm result) {
-                code.roundsd(result, result, *round_imm);
-            });
+            EmitFPRoundInline<64>(code, ctx, inst, rounding_mode, exact);
         } else {
-            FPTwoOp<32>(code, ctx, inst, [&](Xbyak::Xmm result) {
-                code.roundss(result, result, *round_imm);
-            });
+            EmitFPRoundInline<32>(code, ctx, inst, rounding_mode, exact);
         }
-
         return;
     }
 
@@ -901,6 +1121,57 @@ void EmitX64::EmitFPRoundInt64(EmitContext& ctx, IR::Inst* inst) {
 
 template<typename FPT>
 static void EmitFPRSqrtEstimate(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    if constexpr (!std::is_same_v<FPT, u16>) {
+        constexpr int fsize = static_cast<int>(FP::FPInfo<FPT>::total_width);
+        constexpr int mantissa_width = static_cast<int>(FP::FPInfo<FPT>::explicit_mantissa_width);
+        constexpr u32 bias = static_cast<u32>(FP::FPInfo<FPT>::exponent_bias);
+
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+        Xbyak::Label end, fallback;
+
+        const Xbyak::Reg64 operand = ctx.reg_alloc.UseGpr(args[0]);
+        const Xbyak::Reg64 result = ctx.reg_alloc.ScratchGpr();
+        const Xbyak::Reg64 exponent = ctx.reg_alloc.ScratchGpr();
+        const Xbyak::Reg64 table = ctx.reg_alloc.ScratchGpr();
+
+        // Positive normal inputs are a table lookup on the top eight bits of the mantissa, pre-shifted
+        // by one when the exponent is odd; the result exponent is (3 * bias - 1 - exponent) / 2.
+        // Everything else (including all negative inputs) is handled out of line.
+        code.mov(exponent.changeBit(fsize), operand.changeBit(fsize));
+        code.shr(exponent.changeBit(fsize), mantissa_width);
+        code.lea(result.cvt32(), code.ptr[exponent - 1]);
+        code.cmp(result.cvt32(), 2 * bias - 1);
+        code.ja(fallback, code.T_NEAR);
+
+        code.mov(result.changeBit(fsize), operand.changeBit(fsize));
+        code.shr(result.changeBit(fsize), mantissa_width - 8);
+        code.movzx(result.cvt32(), result.cvt8());
+        code.or_(result.cvt32(), 0x100);
+        code.mov(table.cvt32(), result.cvt32());
+        code.shr(table.cvt32(), 1);
+        code.test(exponent.cvt8(), 1);
+        code.cmovnz(result.cvt32(), table.cvt32());
+        code.mov(table, reinterpret_cast<u64>(Common::RecipSqrtEstimateTable().data()));
+        code.mov(result.cvt32(), code.dword[table + result * 4]);
+        code.shl(result, mantissa_width - 8);
+        code.neg(exponent);
+        code.add(exponent, 3 * bias - 1);
+        code.shr(exponent, 1);
+        code.shl(exponent, mantissa_width);
+        code.or_(result, exponent);
+        code.L(end);
+
+        code.SwitchToFarCode();
+        code.L(fallback);
+        EmitFPEstimateFallback<FPT>(code, ctx, &FP::FPRSqrtEstimate<FPT>, result, operand);
+        code.jmp(end, code.T_NEAR);
+        code.SwitchToNearCode();
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     ctx.reg_alloc.HostCall(inst, args[0]);
     code.mov(code.ABI_PARAM2.cvt32(), ctx.FPCR().Value());
@@ -1068,11 +1339,17 @@ void EmitX64::EmitFPCompare64(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, nzcv);
 }
 
+/// F16C never flushes half-precision denormals, whatever the state of MXCSR, which matches the ARM conversions
+/// as they ignore FPCR.FZ16. F16C has no equivalent of the alternative half-precision format.
+static bool CanConvertHalfWithF16C(BlockOfCode& code, EmitContext& ctx) {
+    return code.DoesCpuSupport(Xbyak::util::Cpu::tF16C) && !ctx.FPCR().AHP();
+}
+
 void EmitX64::EmitFPHalfToDouble(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     const auto rounding_mode = static_cast<FP::RoundingMode>(args[1].GetImmediateU8());
 
-    if (code.DoesCpuSupport(Xbyak::util::Cpu::tF16C) && !ctx.FPCR().AHP() && !ctx.FPCR().FZ16()) {
+    if (CanConvertHalfWithF16C(code, ctx)) {
         const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
         const Xbyak::Xmm value = ctx.reg_alloc.UseXmm(args[0]);
 
@@ -1098,7 +1375,7 @@ void EmitX64::EmitFPHalfToSingle(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     const auto rounding_mode = static_cast<FP::RoundingMode>(args[1].GetImmediateU8());
 
-    if (code.DoesCpuSupport(Xbyak::util::Cpu::tF16C) && !ctx.FPCR().AHP() && !ctx.FPCR().FZ16()) {
+    if (CanConvertHalfWithF16C(code, ctx)) {
         const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
         const Xbyak::Xmm value = ctx.reg_alloc.UseXmm(args[0]);
 
@@ -1145,7 +1422,7 @@ void EmitX64::EmitFPSingleToHalf(EmitContext& ctx, IR::Inst* inst) {
     const auto rounding_mode = static_cast<FP::RoundingMode>(args[1].GetImmediateU8());
     const auto round_imm = ConvertRoundingModeToX64Immediate(rounding_mode);
 
-    if (code.DoesCpuSupport(Xbyak::util::Cpu::tF16C) && !ctx.FPCR().AHP() && !ctx.FPCR().FZ16()) {
+    if (round_imm && CanConvertHalfWithF16C(code, ctx)) {
         const Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
 
         if (ctx.FPCR().DN()) {
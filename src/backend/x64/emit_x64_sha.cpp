@@ -0,0 +1,132 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "backend/x64/block_of_code.h"
+#include "backend/x64/emit_x64.h"
+#include "common/assert.h"
+#include "common/common_types.h"
+#include "frontend/ir/microinstruction.h"
+
+namespace Dynarmic::BackendX64 {
+
+using namespace Xbyak::util;
+
+// The A64 frontend only emits these IR instructions when the host supports the SHA extensions,
+// and expands the corresponding ARM instructions into generic IR instructions otherwise.
+
+// The ARM SHA-1 instructions hold the hash state in element order {a, b, c, d}, and expect the round
+// constant to have already been added to the message words. SHA1RNDS4 holds the state in the reverse
+// order, expects e to be added to the first message word, and adds the round constant itself.
+static void EmitSHA1HashUpdate(RegAlloc::ArgumentInfo args, EmitContext& ctx, BlockOfCode& code,
+                               IR::Inst* inst, u8 function, u32 round_constant) {
+    const Xbyak::Xmm abcd = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm e = ctx.reg_alloc.UseScratchXmm(args[1]);
+    const Xbyak::Xmm w = ctx.reg_alloc.UseScratchXmm(args[2]);
+
+    const u64 k = (u64{round_constant} << 32) | round_constant;
+
+    code.psubd(w, code.MConst(xword, k, k));
+    code.pshufd(w, w, 0b00011011);
+    code.pslldq(e, 12);
+    code.paddd(w, e);
+
+    code.pshufd(abcd, abcd, 0b00011011);
+    code.sha1rnds4(abcd, w, function);
+    code.pshufd(abcd, abcd, 0b00011011);
+
+    ctx.reg_alloc.DefineValue(inst, abcd);
+}
+
+void EmitX64::EmitSHA1HashUpdateChoose(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    ASSERT(code.DoesCpuSupport(Xbyak::util::Cpu::tSHA));
+
+    EmitSHA1HashUpdate(args, ctx, code, inst, 0, 0x5A827999);
+}
+
+void EmitX64::EmitSHA1HashUpdateMajority(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    ASSERT(code.DoesCpuSupport(Xbyak::util::Cpu::tSHA));
+
+    EmitSHA1HashUpdate(args, ctx, code, inst, 2, 0x8F1BBCDC);
+}
+
+void EmitX64::EmitSHA1HashUpdateParity(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    ASSERT(code.DoesCpuSupport(Xbyak::util::Cpu::tSHA));
+
+    // Rounds 20-39 and 60-79 both use the parity function; any of their round constants will do here.
+    EmitSHA1HashUpdate(args, ctx, code, inst, 1, 0x6ED9EBA1);
+}
+
+void EmitX64::EmitSHA256Hash(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const bool part1 = args[3].GetImmediateU1();
+
+    ASSERT(code.DoesCpuSupport(Xbyak::util::Cpu::tSHA));
+
+    // The ARM instructions hold the hash state as x = {a, b, c, d} and y = {e, f, g, h}.
+    // SHA256RNDS2 instead expects {f, e, b, a} and {h, g, d, c}, and performs two rounds at a time
+    // using the two lowest words of xmm0.
+    const Xbyak::Xmm x = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm y = ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Xmm w = ctx.reg_alloc.UseXmm(args[2]);
+    const Xbyak::Xmm abef = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm cdgh = ctx.reg_alloc.ScratchXmm();
+
+    code.movaps(abef, y);
+    code.shufps(abef, x, 0b00010001);
+    code.movaps(cdgh, y);
+    code.shufps(cdgh, x, 0b10111011);
+
+    code.movaps(xmm0, w);
+    code.sha256rnds2(cdgh, abef);
+    code.pshufd(xmm0, w, 0b00001110);
+    code.sha256rnds2(abef, cdgh);
+
+    // abef now holds {f, e, b, a} and cdgh holds {h, g, d, c} after four rounds.
+    code.shufps(abef, cdgh, part1 ? 0b10111011 : 0b00010001);
+
+    ctx.reg_alloc.DefineValue(inst, abef);
+}
+
+void EmitX64::EmitSHA256MessageSchedule0(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    ASSERT(code.DoesCpuSupport(Xbyak::util::Cpu::tSHA));
+
+    const Xbyak::Xmm x = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm y = ctx.reg_alloc.UseXmm(args[1]);
+
+    code.sha256msg1(x, y);
+
+    ctx.reg_alloc.DefineValue(inst, x);
+}
+
+void EmitX64::EmitSHA256MessageSchedule1(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    ASSERT(code.DoesCpuSupport(Xbyak::util::Cpu::tSHA));
+
+    const Xbyak::Xmm x = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm y = ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Xmm z = ctx.reg_alloc.UseXmm(args[2]);
+    const Xbyak::Xmm t0 = ctx.reg_alloc.ScratchXmm();
+
+    // SHA256MSG2 expects the first operand to already contain x + {y[1], y[2], y[3], z[0]}.
+    code.movaps(t0, z);
+    code.palignr(t0, y, 4);
+    code.paddd(x, t0);
+    code.sha256msg2(x, z);
+
+    ctx.reg_alloc.DefineValue(inst, x);
+}
+
+} // namespace Dynarmic::BackendX64
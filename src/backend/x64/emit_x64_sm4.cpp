@@ -4,18 +4,120 @@
  * General Public License version 2 or any later version.
  */
 
+#include <array>
+
+#include "backend/x64/abi.h"
 #include "backend/x64/block_of_code.h"
 #include "backend/x64/emit_x64.h"
+#include "backend/x64/sm4_tables.h"
+#include "common/common_types.h"
 #include "common/crypto/sm4.h"
 #include "frontend/ir/microinstruction.h"
 
 namespace Dynarmic::BackendX64 {
 
+using namespace Xbyak::util;
+using namespace SM4Tables;
+
+using Vector = std::array<u8, 16>;
+
+static void SubstituteBytes(Vector& result, const Vector& input) {
+    for (size_t i = 0; i < result.size(); i++) {
+        result[i] = Common::Crypto::SM4::AccessSubstitutionBox(input[i]);
+    }
+}
+
+static void EmitNibbleTransform(BlockOfCode& code, Xbyak::Xmm data, Xbyak::Xmm tmp,
+                                const std::array<u64, 2>& low_nibble, const std::array<u64, 2>& high_nibble) {
+    const Xbyak::Address low_nibble_mask = code.MConst(xword, 0x0F0F0F0F0F0F0F0F, 0x0F0F0F0F0F0F0F0F);
+
+    code.movdqa(tmp, data);
+    code.psrlw(tmp, 4);
+    code.pand(tmp, low_nibble_mask);
+    code.pand(data, low_nibble_mask);
+
+    const Xbyak::Xmm table = xmm0;
+    code.movdqa(table, code.MConst(xword, low_nibble[0], low_nibble[1]));
+    code.pshufb(table, data);
+    code.movdqa(data, code.MConst(xword, high_nibble[0], high_nibble[1]));
+    code.pshufb(data, tmp);
+    code.pxor(data, table);
+}
+
 void EmitX64::EmitSM4AccessSubstitutionBox(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
-    ctx.reg_alloc.HostCall(inst, args[0]);
-    code.CallFunction(&Common::Crypto::SM4::AccessSubstitutionBox);
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tGFNI)) {
+        const Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+
+        code.gf2p8affineqb(data, code.MConst(xword, gfni_pre_matrix, gfni_pre_matrix), gfni_pre_constant);
+        code.gf2p8affineinvqb(data, code.MConst(xword, gfni_post_matrix, gfni_post_matrix), gfni_post_constant);
+
+        ctx.reg_alloc.DefineValue(inst, data);
+        return;
+    }
+
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tAESNI) && code.DoesCpuSupport(Xbyak::util::Cpu::tSSSE3)) {
+        const Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+        EmitNibbleTransform(code, data, tmp, aes_pre_low_nibble, aes_pre_high_nibble);
+
+        // AESENCLAST with a zero round key performs SubBytes and ShiftRows; the latter is undone here.
+        code.pxor(tmp, tmp);
+        code.aesenclast(data, tmp);
+        code.pshufb(data, code.MConst(xword, aes_inverse_shift_rows[0], aes_inverse_shift_rows[1]));
+
+        EmitNibbleTransform(code, data, tmp, aes_post_low_nibble, aes_post_high_nibble);
+
+        ctx.reg_alloc.DefineValue(inst, data);
+        return;
+    }
+
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSSE3)) {
+        const Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+        const Xbyak::Xmm indices = ctx.reg_alloc.ScratchXmm();
+        const Xbyak::Xmm row = ctx.reg_alloc.ScratchXmm();
+
+        // For each row, bytes that lie in that row are biased to 0x70..0x7F and all others saturate to
+        // 0x80 or above, which PSHUFB maps to zero.
+        code.pxor(result, result);
+        for (size_t i = 0; i < substitution_box_rows.size(); i++) {
+            code.movdqa(indices, data);
+            code.paddusb(indices, code.MConst(xword, 0x7070707070707070, 0x7070707070707070));
+            code.movdqa(row, code.MConst(xword, substitution_box_rows[i][0], substitution_box_rows[i][1]));
+            code.pshufb(row, indices);
+            code.por(result, row);
+            if (i != substitution_box_rows.size() - 1) {
+                code.psubb(data, code.MConst(xword, 0x1010101010101010, 0x1010101010101010));
+            }
+        }
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    constexpr u32 stack_space = static_cast<u32>(sizeof(Vector)) * 2;
+    const Xbyak::Xmm input = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    ctx.reg_alloc.EndOfAllocScope();
+
+    ctx.reg_alloc.HostCall(nullptr);
+    code.sub(rsp, stack_space + ABI_SHADOW_SPACE);
+    code.lea(code.ABI_PARAM1, ptr[rsp + ABI_SHADOW_SPACE]);
+    code.lea(code.ABI_PARAM2, ptr[rsp + ABI_SHADOW_SPACE + sizeof(Vector)]);
+
+    code.movaps(xword[code.ABI_PARAM2], input);
+
+    code.CallFunction(&SubstituteBytes);
+
+    code.movaps(result, xword[rsp + ABI_SHADOW_SPACE]);
+
+    // Free memory
+    code.add(rsp, stack_space + ABI_SHADOW_SPACE);
+
+    ctx.reg_alloc.DefineValue(inst, result);
 }
 
 } // namespace Dynarmic::BackendX64
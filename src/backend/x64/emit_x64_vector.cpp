@@ -5,8 +5,10 @@
  */
 
 #include <algorithm>
+#include <array>
 #include <bitset>
 #include <cstdlib>
+#include <optional>
 #include <type_traits>
 
 #include "backend/x64/abi.h"
@@ -509,6 +511,265 @@ void EmitX64::EmitVectorArithmeticShiftRight64(EmitContext& ctx, IR::Inst* inst)
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
+// Shifts each 8-bit or 16-bit lane of value by the corresponding lane of amount, which must lie in [0, esize].
+// The shift is built from power-of-two steps, each selected by one bit of the amount. Clobbers xmm0.
+static void EmitVectorShiftBySteps(BlockOfCode& code, size_t esize, bool left, const Xbyak::Xmm& value, const Xbyak::Xmm& amount, const Xbyak::Xmm& tmp) {
+    ASSERT(esize == 8 || esize == 16);
+
+    const size_t step_count = esize == 8 ? 4 : 5;
+    for (size_t step = 0; step < step_count; step++) {
+        const size_t shift = size_t(1) << step;
+
+        // Move the selecting bit of the amount into the sign position of every byte of the lane.
+        code.movdqa(xmm0, amount);
+        if (esize == 8) {
+            code.psllw(xmm0, static_cast<u8>(7 - step));
+        } else {
+            code.psllw(xmm0, static_cast<u8>(15 - step));
+            code.psraw(xmm0, 15);
+        }
+
+        if (shift == esize) {
+            code.pxor(tmp, tmp);
+        } else {
+            code.movdqa(tmp, value);
+            if (left) {
+                code.psllw(tmp, static_cast<u8>(shift));
+            } else {
+                code.psrlw(tmp, static_cast<u8>(shift));
+            }
+            if (esize == 8) {
+                const u64 mask = Common::Replicate<u64>(left ? u8(0xFF << shift) : u8(0xFF >> shift), 8);
+                code.pand(tmp, code.MConst(xword, mask, mask));
+            }
+        }
+
+        code.pblendvb(value, tmp);
+    }
+}
+
+// Implements [S|U]SHL and [S|U]RSHL on 8-bit and 16-bit lanes using SSE4.1.
+// Signed right shifts are performed as logical shifts of (x ^ sign), as there are no variable arithmetic shifts.
+// A rounding right shift by n is performed as a shift by n - 1 followed by a rounded shift by one.
+static void EmitVectorVariableShiftSSE41(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, size_t esize, bool is_signed, bool rounding) {
+    ASSERT(esize == 8 || esize == 16);
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm shift = ctx.reg_alloc.UseScratchXmm(args[1]);
+    const Xbyak::Xmm amount = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm right = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm sign = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    const u64 limit = Common::Replicate<u64>(esize, esize);
+    const u64 lsb = Common::Replicate<u64>(1, esize);
+
+    if (esize == 16) {
+        // Only the bottom byte of each lane is the (signed) shift amount.
+        code.psllw(shift, 8);
+        code.psraw(shift, 8);
+    }
+
+    if (rounding) {
+        code.pcmpeqw(amount, amount);
+        code.pxor(amount, shift);
+    } else {
+        code.pxor(amount, amount);
+        if (esize == 8) {
+            code.psubb(amount, shift);
+        } else {
+            code.psubw(amount, shift);
+        }
+    }
+    if (esize == 8) {
+        code.pminub(amount, code.MConst(xword, limit, limit));
+    } else {
+        code.pminuw(amount, code.MConst(xword, limit, limit));
+    }
+
+    code.movdqa(right, result);
+    if (is_signed) {
+        if (esize == 8) {
+            code.pxor(sign, sign);
+            code.pcmpgtb(sign, result);
+        } else {
+            code.movdqa(sign, result);
+            code.psraw(sign, 15);
+        }
+        code.pxor(right, sign);
+    }
+
+    EmitVectorShiftBySteps(code, esize, false, right, amount, tmp);
+
+    if (rounding) {
+        code.movdqa(tmp, right);
+        if (is_signed) {
+            code.pxor(tmp, sign);
+        }
+        code.pand(tmp, code.MConst(xword, lsb, lsb));
+
+        code.psrlw(right, 1);
+        if (esize == 8) {
+            code.pand(right, code.MConst(xword, 0x7F7F7F7F7F7F7F7F, 0x7F7F7F7F7F7F7F7F));
+        }
+    }
+    if (is_signed) {
+        code.pxor(right, sign);
+    }
+    if (rounding) {
+        if (esize == 8) {
+            code.paddb(right, tmp);
+        } else {
+            code.paddw(right, tmp);
+        }
+    }
+
+    code.movdqa(amount, shift);
+    if (esize == 8) {
+        code.pminub(amount, code.MConst(xword, limit, limit));
+    } else {
+        code.pminuw(amount, code.MConst(xword, limit, limit));
+    }
+
+    EmitVectorShiftBySteps(code, esize, true, result, amount, tmp);
+
+    // Negative shift amounts select the right shifted value.
+    code.movdqa(xmm0, shift);
+    code.pblendvb(result, right);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+// Implements [S|U]SHL and [S|U]RSHL on 16-bit (requires AVX512VL and AVX512BW), 32-bit and 64-bit (requires AVX2) lanes.
+// As above, signed right shifts are performed as logical shifts of (x ^ sign).
+static void EmitVectorVariableShiftAVX(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, size_t esize, bool is_signed, bool rounding) {
+    ASSERT(esize == 16 || esize == 32 || esize == 64);
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm left_shift = ctx.reg_alloc.UseScratchXmm(args[1]);
+    const Xbyak::Xmm right_shift = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm right = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm sign = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    const u64 byte_mask = Common::Replicate<u64>(0xFF, esize);
+    const u64 lsb = Common::Replicate<u64>(1, esize);
+
+    // Negative shift amounts select the right shifted value.
+    switch (esize) {
+    case 16:
+        code.vpsllw(xmm0, left_shift, 8);
+        code.vpsraw(xmm0, xmm0, 15);
+        break;
+    case 32:
+        code.vpslld(xmm0, left_shift, 24);
+        break;
+    case 64:
+        code.vpsllq(xmm0, left_shift, 56);
+        break;
+    }
+
+    if (rounding) {
+        // A rounding right shift by n is performed as a shift by n - 1 followed by a rounded shift by one.
+        code.vpcmpeqb(tmp, tmp, tmp);
+        code.vpxor(right_shift, left_shift, tmp);
+    } else {
+        code.vpxor(right_shift, right_shift, right_shift);
+        code.vpsubb(right_shift, right_shift, left_shift);
+    }
+    code.vmovdqa(tmp, code.MConst(xword, byte_mask, byte_mask));
+    code.vpand(right_shift, right_shift, tmp);
+    code.vpand(left_shift, left_shift, tmp);
+
+    if (is_signed) {
+        switch (esize) {
+        case 16:
+            code.vpsraw(sign, result, 15);
+            break;
+        case 32:
+            code.vpsrad(sign, result, 31);
+            break;
+        case 64:
+            code.vpxor(sign, sign, sign);
+            code.vpcmpgtq(sign, sign, result);
+            break;
+        }
+        code.vpxor(right, result, sign);
+    } else {
+        code.vmovdqa(right, result);
+    }
+
+    switch (esize) {
+    case 16:
+        code.vpsrlvw(right, right, right_shift);
+        code.vpsllvw(result, result, left_shift);
+        break;
+    case 32:
+        code.vpsrlvd(right, right, right_shift);
+        code.vpsllvd(result, result, left_shift);
+        break;
+    case 64:
+        code.vpsrlvq(right, right, right_shift);
+        code.vpsllvq(result, result, left_shift);
+        break;
+    }
+
+    if (rounding) {
+        if (is_signed) {
+            code.vpxor(tmp, right, sign);
+            code.vpand(tmp, tmp, code.MConst(xword, lsb, lsb));
+        } else {
+            code.vpand(tmp, right, code.MConst(xword, lsb, lsb));
+        }
+
+        switch (esize) {
+        case 16:
+            code.vpsrlw(right, right, 1);
+            break;
+        case 32:
+            code.vpsrld(right, right, 1);
+            break;
+        case 64:
+            code.vpsrlq(right, right, 1);
+            break;
+        }
+    }
+    if (is_signed) {
+        code.vpxor(right, right, sign);
+    }
+    if (rounding) {
+        switch (esize) {
+        case 16:
+            code.vpaddw(right, right, tmp);
+            break;
+        case 32:
+            code.vpaddd(right, right, tmp);
+            break;
+        case 64:
+            code.vpaddq(right, right, tmp);
+            break;
+        }
+    }
+
+    switch (esize) {
+    case 16:
+        code.pblendvb(result, right);
+        break;
+    case 32:
+        code.blendvps(result, right);
+        break;
+    case 64:
+        code.blendvpd(result, right);
+        break;
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
 template <typename T>
 static constexpr T VShift(T x, T y) {
     const s8 shift_amount = static_cast<s8>(static_cast<u8>(y));
@@ -538,6 +799,11 @@ static constexpr T VShift(T x, T y) {
 }
 
 void EmitX64::EmitVectorArithmeticVShift8(EmitContext& ctx, IR::Inst* inst) {
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorVariableShiftSSE41(code, ctx, inst, 8, true, false);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s8>& result, const VectorArray<s8>& a, const VectorArray<s8>& b) {
         std::transform(a.begin(), a.end(), b.begin(), result.begin(), VShift<s8>);
     });
@@ -570,6 +836,11 @@ void EmitX64::EmitVectorArithmeticVShift16(EmitContext& ctx, IR::Inst* inst) {
         return;
     }
 
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorVariableShiftSSE41(code, ctx, inst, 16, true, false);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s16>& result, const VectorArray<s16>& a, const VectorArray<s16>& b) {
         std::transform(a.begin(), a.end(), b.begin(), result.begin(), VShift<s16>);
     });
@@ -632,6 +903,11 @@ void EmitX64::EmitVectorArithmeticVShift64(EmitContext& ctx, IR::Inst* inst) {
         return;
     }
 
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tAVX2)) {
+        EmitVectorVariableShiftAVX(code, ctx, inst, 64, true, false);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s64>& result, const VectorArray<s64>& a, const VectorArray<s64>& b) {
         std::transform(a.begin(), a.end(), b.begin(), result.begin(), VShift<s64>);
     });
@@ -751,6 +1027,23 @@ static void EmitVectorCountLeadingZeros(VectorArray<T>& result, const VectorArra
     }
 }
 
+// Replaces each byte of data with its leading zero count, using a nibble lookup table. Requires SSSE3.
+static void EmitVectorCountLeadingZerosBytes(BlockOfCode& code, const Xbyak::Xmm& data, const Xbyak::Xmm& tmp1, const Xbyak::Xmm& tmp2) {
+    code.movdqa(tmp1, code.MConst(xword, 0x0101010102020304, 0x0000000000000000));
+    code.movdqa(tmp2, tmp1);
+
+    code.pshufb(tmp2, data);
+    code.psrlw(data, 4);
+    code.pand(data, code.MConst(xword, 0x0F0F0F0F0F0F0F0F, 0x0F0F0F0F0F0F0F0F));
+    code.pshufb(tmp1, data);
+
+    code.movdqa(data, code.MConst(xword, 0x0404040404040404, 0x0404040404040404));
+
+    code.pcmpeqb(data, tmp1);
+    code.pand(data, tmp2);
+    code.paddb(data, tmp1);
+}
+
 void EmitX64::EmitVectorCountLeadingZeros8(EmitContext& ctx, IR::Inst* inst) {
     if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSSE3)) {
         auto args = ctx.reg_alloc.GetArgumentInfo(inst);
@@ -759,19 +1052,7 @@ void EmitX64::EmitVectorCountLeadingZeros8(EmitContext& ctx, IR::Inst* inst) {
         const Xbyak::Xmm tmp1 = ctx.reg_alloc.ScratchXmm();
         const Xbyak::Xmm tmp2 = ctx.reg_alloc.ScratchXmm();
 
-        code.movdqa(tmp1, code.MConst(xword, 0x0101010102020304, 0x0000000000000000));
-        code.movdqa(tmp2, tmp1);
-
-        code.pshufb(tmp2, data);
-        code.psrlw(data, 4);
-        code.pand(data, code.MConst(xword, 0x0F0F0F0F0F0F0F0F, 0x0F0F0F0F0F0F0F0F));
-        code.pshufb(tmp1, data);
-
-        code.movdqa(data, code.MConst(xword, 0x0404040404040404, 0x0404040404040404));
-
-        code.pcmpeqb(data, tmp1);
-        code.pand(data, tmp2);
-        code.paddb(data, tmp1);
+        EmitVectorCountLeadingZerosBytes(code, data, tmp1, tmp2);
 
         ctx.reg_alloc.DefineValue(inst, data);
         return;
@@ -781,6 +1062,28 @@ void EmitX64::EmitVectorCountLeadingZeros8(EmitContext& ctx, IR::Inst* inst) {
 }
 
 void EmitX64::EmitVectorCountLeadingZeros16(EmitContext& ctx, IR::Inst* inst) {
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tAVX512CD) && code.DoesCpuSupport(Xbyak::util::Cpu::tAVX512VL)) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+        const Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+        const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+        // Setting bit 15 of each doubleword caps the count at 16 when the halfword of interest is zero.
+        code.vmovdqa(tmp, code.MConst(xword, 0x0000800000008000, 0x0000800000008000));
+        code.vpor(result, data, tmp);
+        code.vplzcntd(result, result);
+        code.vpslld(result, result, 16);
+
+        code.vpslld(data, data, 16);
+        code.vpor(data, data, tmp);
+        code.vplzcntd(data, data);
+        code.vpor(result, result, data);
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
     if (code.DoesCpuSupport(Xbyak::util::Cpu::tAVX)) {
         auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
@@ -863,6 +1166,34 @@ void EmitX64::EmitVectorCountLeadingZeros32(EmitContext& ctx, IR::Inst* inst) {
         return;
     }
 
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSSE3)) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+        const Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm tmp1 = ctx.reg_alloc.ScratchXmm();
+        const Xbyak::Xmm tmp2 = ctx.reg_alloc.ScratchXmm();
+
+        EmitVectorCountLeadingZerosBytes(code, data, tmp1, tmp2);
+
+        // Merge adjacent counts: the count of the upper half, plus that of the lower half if the upper half was all zeros.
+        code.movdqa(tmp1, data);
+        code.pcmpeqb(tmp1, code.MConst(xword, 0x0808080808080808, 0x0808080808080808));
+        code.psrlw(tmp1, 8);
+        code.pand(tmp1, data);
+        code.psrlw(data, 8);
+        code.paddw(data, tmp1);
+
+        code.movdqa(tmp1, data);
+        code.pcmpeqw(tmp1, code.MConst(xword, 0x0010001000100010, 0x0010001000100010));
+        code.psrld(tmp1, 16);
+        code.pand(tmp1, data);
+        code.psrld(data, 16);
+        code.paddd(data, tmp1);
+
+        ctx.reg_alloc.DefineValue(inst, data);
+        return;
+    }
+
     EmitOneArgumentFallback(code, ctx, inst, EmitVectorCountLeadingZeros<u32>);
 }
 
@@ -976,6 +1307,111 @@ void EmitX64::EmitVectorDeinterleaveOdd64(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, lhs);
 }
 
+// Each entry of selector names the byte of the 48-byte concatenation of the three operands that is
+// placed into the corresponding byte of the result.
+static void EmitVectorTripleShuffle(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, const std::array<u8, 16>& selector) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const auto to_mconst = [&code](const std::array<u8, 16>& bytes) {
+        u64 lo = 0;
+        u64 hi = 0;
+        for (size_t i = 0; i < 8; i++) {
+            lo |= u64(bytes[i]) << (i * 8);
+            hi |= u64(bytes[i + 8]) << (i * 8);
+        }
+        return code.MConst(xword, lo, hi);
+    };
+
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSSE3)) {
+        std::optional<Xbyak::Xmm> result;
+
+        for (size_t source = 0; source < 3; source++) {
+            std::array<u8, 16> mask;
+            mask.fill(0x80);
+            bool used = false;
+            for (size_t i = 0; i < 16; i++) {
+                if (selector[i] / 16 == source) {
+                    mask[i] = static_cast<u8>(selector[i] % 16);
+                    used = true;
+                }
+            }
+            if (!used) {
+                continue;
+            }
+
+            const Xbyak::Xmm xmm = ctx.reg_alloc.UseScratchXmm(args[source]);
+            code.pshufb(xmm, to_mconst(mask));
+            if (result) {
+                code.por(*result, xmm);
+            } else {
+                result = xmm;
+            }
+        }
+
+        ctx.reg_alloc.DefineValue(inst, *result);
+        return;
+    }
+
+    constexpr u32 stack_space = 4 * 16;
+    const Xbyak::Xmm arg1 = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm arg2 = ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Xmm arg3 = ctx.reg_alloc.UseXmm(args[2]);
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    ctx.reg_alloc.EndOfAllocScope();
+
+    ctx.reg_alloc.HostCall(nullptr);
+    code.sub(rsp, stack_space + ABI_SHADOW_SPACE);
+    code.lea(code.ABI_PARAM1, ptr[rsp + ABI_SHADOW_SPACE + 0 * 16]);
+    code.lea(code.ABI_PARAM2, ptr[rsp + ABI_SHADOW_SPACE + 1 * 16]);
+    code.lea(code.ABI_PARAM3, to_mconst(selector));
+
+    code.movaps(xword[code.ABI_PARAM2 + 0 * 16], arg1);
+    code.movaps(xword[code.ABI_PARAM2 + 1 * 16], arg2);
+    code.movaps(xword[code.ABI_PARAM2 + 2 * 16], arg3);
+    code.CallFunction(static_cast<void(*)(VectorArray<u8>&, const std::array<u8, 48>&, const VectorArray<u8>&)>(
+        [](VectorArray<u8>& result, const std::array<u8, 48>& concatenation, const VectorArray<u8>& selector) {
+            for (size_t i = 0; i < result.size(); i++) {
+                result[i] = concatenation[selector[i]];
+            }
+        }));
+    code.movaps(result, xword[rsp + ABI_SHADOW_SPACE + 0 * 16]);
+
+    code.add(rsp, stack_space + ABI_SHADOW_SPACE);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+static void EmitVectorDeinterleaveTriple(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, size_t esize) {
+    ASSERT(inst->GetArg(3).IsImmediate());
+    const size_t index = inst->GetArg(3).GetU8();
+    const size_t ebytes = esize / 8;
+
+    // Element e of the result is member `index` of structure e.
+    std::array<u8, 16> selector;
+    for (size_t i = 0; i < 16; i++) {
+        const size_t element = (i / ebytes) * 3 + index;
+        selector[i] = static_cast<u8>(element * ebytes + i % ebytes);
+    }
+
+    EmitVectorTripleShuffle(code, ctx, inst, selector);
+}
+
+void EmitX64::EmitVectorDeinterleaveTriple8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorDeinterleaveTriple(code, ctx, inst, 8);
+}
+
+void EmitX64::EmitVectorDeinterleaveTriple16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorDeinterleaveTriple(code, ctx, inst, 16);
+}
+
+void EmitX64::EmitVectorDeinterleaveTriple32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorDeinterleaveTriple(code, ctx, inst, 32);
+}
+
+void EmitX64::EmitVectorDeinterleaveTriple64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorDeinterleaveTriple(code, ctx, inst, 64);
+}
+
 void EmitX64::EmitVectorEor(EmitContext& ctx, IR::Inst* inst) {
     EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pxor);
 }
@@ -1354,6 +1790,37 @@ void EmitX64::EmitVectorInterleaveUpper64(EmitContext& ctx, IR::Inst* inst) {
     EmitVectorInterleaveUpper(code, ctx, inst, 64);
 }
 
+static void EmitVectorInterleaveTriple(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, size_t esize) {
+    ASSERT(inst->GetArg(3).IsImmediate());
+    const size_t index = inst->GetArg(3).GetU8();
+    const size_t ebytes = esize / 8;
+
+    // The result is the index-th 128-bit chunk of the three operands stored as consecutive structures.
+    std::array<u8, 16> selector;
+    for (size_t i = 0; i < 16; i++) {
+        const size_t element = (index * 16 + i) / ebytes;
+        selector[i] = static_cast<u8>((element % 3) * 16 + (element / 3) * ebytes + i % ebytes);
+    }
+
+    EmitVectorTripleShuffle(code, ctx, inst, selector);
+}
+
+void EmitX64::EmitVectorInterleaveTriple8(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorInterleaveTriple(code, ctx, inst, 8);
+}
+
+void EmitX64::EmitVectorInterleaveTriple16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorInterleaveTriple(code, ctx, inst, 16);
+}
+
+void EmitX64::EmitVectorInterleaveTriple32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorInterleaveTriple(code, ctx, inst, 32);
+}
+
+void EmitX64::EmitVectorInterleaveTriple64(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorInterleaveTriple(code, ctx, inst, 64);
+}
+
 void EmitX64::EmitVectorLogicalShiftLeft8(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
@@ -1457,6 +1924,11 @@ void EmitX64::EmitVectorLogicalShiftRight64(EmitContext& ctx, IR::Inst* inst) {
 }
 
 void EmitX64::EmitVectorLogicalVShift8(EmitContext& ctx, IR::Inst* inst) {
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorVariableShiftSSE41(code, ctx, inst, 8, false, false);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u8>& result, const VectorArray<u8>& a, const VectorArray<u8>& b) {
         std::transform(a.begin(), a.end(), b.begin(), result.begin(), VShift<u8>);
     });
@@ -1485,6 +1957,11 @@ void EmitX64::EmitVectorLogicalVShift16(EmitContext& ctx, IR::Inst* inst) {
         return;
     }
 
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorVariableShiftSSE41(code, ctx, inst, 16, false, false);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u16>& result, const VectorArray<u16>& a, const VectorArray<u16>& b) {
         std::transform(a.begin(), a.end(), b.begin(), result.begin(), VShift<u16>);
     });
@@ -1611,6 +2088,20 @@ void EmitX64::EmitVectorMaxS64(EmitContext& ctx, IR::Inst* inst) {
         return;
     }
 
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSE42)) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+        const Xbyak::Xmm x = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm y = ctx.reg_alloc.UseXmm(args[1]);
+
+        code.movdqa(xmm0, y);
+        code.pcmpgtq(xmm0, x);
+        code.blendvpd(x, y);
+
+        ctx.reg_alloc.DefineValue(inst, x);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s64>& result, const VectorArray<s64>& a, const VectorArray<s64>& b) {
         std::transform(a.begin(), a.end(), b.begin(), result.begin(), [](auto x, auto y) { return std::max(x, y); });
     });
@@ -1686,6 +2177,24 @@ void EmitX64::EmitVectorMaxU64(EmitContext& ctx, IR::Inst* inst) {
         return;
     }
 
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSE42)) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+        const Xbyak::Xmm x = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm y = ctx.reg_alloc.UseXmm(args[1]);
+        const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+        code.movdqa(tmp, code.MConst(xword, 0x8000000000000000, 0x8000000000000000));
+        code.movdqa(xmm0, y);
+        code.pxor(xmm0, tmp);
+        code.pxor(tmp, x);
+        code.pcmpgtq(xmm0, tmp);
+        code.blendvpd(x, y);
+
+        ctx.reg_alloc.DefineValue(inst, x);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u64>& result, const VectorArray<u64>& a, const VectorArray<u64>& b) {
         std::transform(a.begin(), a.end(), b.begin(), result.begin(), [](auto x, auto y) { return std::max(x, y); });
     });
@@ -1756,6 +2265,20 @@ void EmitX64::EmitVectorMinS64(EmitContext& ctx, IR::Inst* inst) {
         return;
     }
 
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSE42)) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+        const Xbyak::Xmm x = ctx.reg_alloc.UseXmm(args[0]);
+        const Xbyak::Xmm y = ctx.reg_alloc.UseScratchXmm(args[1]);
+
+        code.movdqa(xmm0, y);
+        code.pcmpgtq(xmm0, x);
+        code.blendvpd(y, x);
+
+        ctx.reg_alloc.DefineValue(inst, y);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s64>& result, const VectorArray<s64>& a, const VectorArray<s64>& b){
         std::transform(a.begin(), a.end(), b.begin(), result.begin(), [](auto x, auto y) { return std::min(x, y); });
     });
@@ -1836,6 +2359,24 @@ void EmitX64::EmitVectorMinU64(EmitContext& ctx, IR::Inst* inst) {
         return;
     }
 
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSE42)) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+        const Xbyak::Xmm x = ctx.reg_alloc.UseXmm(args[0]);
+        const Xbyak::Xmm y = ctx.reg_alloc.UseScratchXmm(args[1]);
+        const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+        code.movdqa(tmp, code.MConst(xword, 0x8000000000000000, 0x8000000000000000));
+        code.movdqa(xmm0, y);
+        code.pxor(xmm0, tmp);
+        code.pxor(tmp, x);
+        code.pcmpgtq(xmm0, tmp);
+        code.blendvpd(y, x);
+
+        ctx.reg_alloc.DefineValue(inst, y);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u64>& result, const VectorArray<u64>& a, const VectorArray<u64>& b){
         std::transform(a.begin(), a.end(), b.begin(), result.begin(), [](auto x, auto y) { return std::min(x, y); });
     });
@@ -2289,6 +2830,32 @@ static void PairedOperation(VectorArray<T>& result, const VectorArray<T>& x, con
     }
 }
 
+// Separates the even and odd elements of the concatenation of both arguments, then combines them with fn.
+template <typename Function>
+static void EmitVectorPairedMinMax(size_t esize, BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Function fn) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm x = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm y = ctx.reg_alloc.UseScratchXmm(args[1]);
+    const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    // Moves the even elements into the lower half and the odd elements into the upper half.
+    if (esize == 8) {
+        code.movdqa(tmp, code.MConst(xword, 0x0E0C0A0806040200, 0x0F0D0B0907050301));
+    } else {
+        code.movdqa(tmp, code.MConst(xword, 0x0D0C090805040100, 0x0F0E0B0A07060302));
+    }
+    code.pshufb(x, tmp);
+    code.pshufb(y, tmp);
+
+    code.movdqa(tmp, x);
+    code.punpcklqdq(x, y);
+    code.punpckhqdq(tmp, y);
+    (code.*fn)(x, tmp);
+
+    ctx.reg_alloc.DefineValue(inst, x);
+}
+
 template <typename T>
 static void PairedMax(VectorArray<T>& result, const VectorArray<T>& x, const VectorArray<T>& y) {
     PairedOperation(result, x, y, [](auto a, auto b) { return std::max(a, b); });
@@ -2300,12 +2867,22 @@ static void PairedMin(VectorArray<T>& result, const VectorArray<T>& x, const Vec
 }
 
 void EmitX64::EmitVectorPairedMaxS8(EmitContext& ctx, IR::Inst* inst) {
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorPairedMinMax(8, code, ctx, inst, &Xbyak::CodeGenerator::pmaxsb);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s8>& result, const VectorArray<s8>& a, const VectorArray<s8>& b) {
         PairedMax(result, a, b);
     });
 }
 
 void EmitX64::EmitVectorPairedMaxS16(EmitContext& ctx, IR::Inst* inst) {
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorPairedMinMax(16, code, ctx, inst, &Xbyak::CodeGenerator::pmaxsw);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s16>& result, const VectorArray<s16>& a, const VectorArray<s16>& b) {
         PairedMax(result, a, b);
     });
@@ -2340,12 +2917,22 @@ void EmitX64::EmitVectorPairedMaxS32(EmitContext& ctx, IR::Inst* inst) {
 }
 
 void EmitX64::EmitVectorPairedMaxU8(EmitContext& ctx, IR::Inst* inst) {
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorPairedMinMax(8, code, ctx, inst, &Xbyak::CodeGenerator::pmaxub);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u8>& result, const VectorArray<u8>& a, const VectorArray<u8>& b) {
         PairedMax(result, a, b);
     });
 }
 
 void EmitX64::EmitVectorPairedMaxU16(EmitContext& ctx, IR::Inst* inst) {
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorPairedMinMax(16, code, ctx, inst, &Xbyak::CodeGenerator::pmaxuw);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u16>& result, const VectorArray<u16>& a, const VectorArray<u16>& b) {
         PairedMax(result, a, b);
     });
@@ -2385,12 +2972,22 @@ void EmitX64::EmitVectorPairedMaxU32(EmitContext& ctx, IR::Inst* inst) {
 }
 
 void EmitX64::EmitVectorPairedMinS8(EmitContext& ctx, IR::Inst* inst) {
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorPairedMinMax(8, code, ctx, inst, &Xbyak::CodeGenerator::pminsb);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s8>& result, const VectorArray<s8>& a, const VectorArray<s8>& b) {
         PairedMin(result, a, b);
     });
 }
 
 void EmitX64::EmitVectorPairedMinS16(EmitContext& ctx, IR::Inst* inst) {
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorPairedMinMax(16, code, ctx, inst, &Xbyak::CodeGenerator::pminsw);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s16>& result, const VectorArray<s16>& a, const VectorArray<s16>& b) {
         PairedMin(result, a, b);
     });
@@ -2425,12 +3022,22 @@ void EmitX64::EmitVectorPairedMinS32(EmitContext& ctx, IR::Inst* inst) {
 }
 
 void EmitX64::EmitVectorPairedMinU8(EmitContext& ctx, IR::Inst* inst) {
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorPairedMinMax(8, code, ctx, inst, &Xbyak::CodeGenerator::pminub);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u8>& result, const VectorArray<u8>& a, const VectorArray<u8>& b) {
         PairedMin(result, a, b);
     });
 }
 
 void EmitX64::EmitVectorPairedMinU16(EmitContext& ctx, IR::Inst* inst) {
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorPairedMinMax(16, code, ctx, inst, &Xbyak::CodeGenerator::pminuw);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u16>& result, const VectorArray<u16>& a, const VectorArray<u16>& b) {
         PairedMin(result, a, b);
     });
@@ -2485,20 +3092,79 @@ static D PolynomialMultiply(T lhs, T rhs) {
 }
 
 void EmitX64::EmitVectorPolynomialMultiply8(EmitContext& ctx, IR::Inst* inst) {
-    EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u8>& result, const VectorArray<u8>& a, const VectorArray<u8>& b) {
-        std::transform(a.begin(), a.end(), b.begin(), result.begin(), PolynomialMultiply<u8, u8>);
-    });
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const Xbyak::Xmm xmm_a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm xmm_b = ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm mask = ctx.reg_alloc.ScratchXmm();
+
+    // Horner's scheme over the bits of a, from the most significant bit downwards.
+    // Each bit of a is moved into the sign position in turn to produce a byte mask.
+    for (size_t i = 0; i < 8; i++) {
+        if (i == 0) {
+            code.pxor(result, result);
+        } else {
+            code.paddb(result, result);
+        }
+        code.pxor(mask, mask);
+        code.pcmpgtb(mask, xmm_a);
+        code.pand(mask, xmm_b);
+        code.pxor(result, mask);
+        if (i != 7) {
+            code.paddb(xmm_a, xmm_a);
+        }
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
 }
 
 void EmitX64::EmitVectorPolynomialMultiplyLong8(EmitContext& ctx, IR::Inst* inst) {
-    EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u16>& result, const VectorArray<u8>& a, const VectorArray<u8>& b) {
-        for (size_t i = 0; i < result.size(); i++) {
-            result[i] = PolynomialMultiply<u16, u8>(a[i], b[i]);
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const Xbyak::Xmm xmm_a = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm xmm_b = ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Xmm a_hi = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm b_wide = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm mask = ctx.reg_alloc.ScratchXmm();
+
+    // As above, but in 16-bit lanes: bytes of a are placed in the upper half of each word
+    // so that their bits pass through the sign position, and bytes of b are zero-extended.
+    code.pxor(a_hi, a_hi);
+    code.punpcklbw(a_hi, xmm_a);
+    code.pxor(b_wide, b_wide);
+    code.punpcklbw(b_wide, xmm_b);
+    code.psrlw(b_wide, 8);
+
+    for (size_t i = 0; i < 8; i++) {
+        if (i == 0) {
+            code.pxor(result, result);
+        } else {
+            code.paddw(result, result);
         }
-    });
+        code.pxor(mask, mask);
+        code.pcmpgtw(mask, a_hi);
+        code.pand(mask, b_wide);
+        code.pxor(result, mask);
+        if (i != 7) {
+            code.paddw(a_hi, a_hi);
+        }
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
 }
 
 void EmitX64::EmitVectorPolynomialMultiplyLong64(EmitContext& ctx, IR::Inst* inst) {
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tPCLMULQDQ)) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+        const Xbyak::Xmm xmm_a = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm xmm_b = ctx.reg_alloc.UseXmm(args[1]);
+
+        code.pclmulqdq(xmm_a, xmm_b, 0x00);
+
+        ctx.reg_alloc.DefineValue(inst, xmm_a);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u64>& result, const VectorArray<u64>& a, const VectorArray<u64>& b) {
         const auto handle_high_bits = [](u64 lhs, u64 rhs) {
             constexpr size_t bit_size = Common::BitSize<u64>();
@@ -2739,48 +3405,98 @@ static void RoundingShiftLeft(VectorArray<T>& out, const VectorArray<T>& lhs, co
 }
 
 void EmitX64::EmitVectorRoundingShiftLeftS8(EmitContext& ctx, IR::Inst* inst) {
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorVariableShiftSSE41(code, ctx, inst, 8, true, true);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s8>& result, const VectorArray<s8>& lhs, const VectorArray<s8>& rhs) {
         RoundingShiftLeft(result, lhs, rhs);
     });
 }
 
 void EmitX64::EmitVectorRoundingShiftLeftS16(EmitContext& ctx, IR::Inst* inst) {
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tAVX512VL) && code.DoesCpuSupport(Xbyak::util::Cpu::tAVX512BW)) {
+        EmitVectorVariableShiftAVX(code, ctx, inst, 16, true, true);
+        return;
+    }
+
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorVariableShiftSSE41(code, ctx, inst, 16, true, true);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s16>& result, const VectorArray<s16>& lhs, const VectorArray<s16>& rhs) {
         RoundingShiftLeft(result, lhs, rhs);
     });
 }
 
 void EmitX64::EmitVectorRoundingShiftLeftS32(EmitContext& ctx, IR::Inst* inst) {
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tAVX2)) {
+        EmitVectorVariableShiftAVX(code, ctx, inst, 32, true, true);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s32>& result, const VectorArray<s32>& lhs, const VectorArray<s32>& rhs) {
         RoundingShiftLeft(result, lhs, rhs);
     });
 }
 
 void EmitX64::EmitVectorRoundingShiftLeftS64(EmitContext& ctx, IR::Inst* inst) {
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tAVX2)) {
+        EmitVectorVariableShiftAVX(code, ctx, inst, 64, true, true);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s64>& result, const VectorArray<s64>& lhs, const VectorArray<s64>& rhs) {
         RoundingShiftLeft(result, lhs, rhs);
     });
 }
 
 void EmitX64::EmitVectorRoundingShiftLeftU8(EmitContext& ctx, IR::Inst* inst) {
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorVariableShiftSSE41(code, ctx, inst, 8, false, true);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u8>& result, const VectorArray<u8>& lhs, const VectorArray<s8>& rhs) {
         RoundingShiftLeft(result, lhs, rhs);
     });
 }
 
 void EmitX64::EmitVectorRoundingShiftLeftU16(EmitContext& ctx, IR::Inst* inst) {
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tAVX512VL) && code.DoesCpuSupport(Xbyak::util::Cpu::tAVX512BW)) {
+        EmitVectorVariableShiftAVX(code, ctx, inst, 16, false, true);
+        return;
+    }
+
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
+        EmitVectorVariableShiftSSE41(code, ctx, inst, 16, false, true);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u16>& result, const VectorArray<u16>& lhs, const VectorArray<s16>& rhs) {
         RoundingShiftLeft(result, lhs, rhs);
     });
 }
 
 void EmitX64::EmitVectorRoundingShiftLeftU32(EmitContext& ctx, IR::Inst* inst) {
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tAVX2)) {
+        EmitVectorVariableShiftAVX(code, ctx, inst, 32, false, true);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u32>& result, const VectorArray<u32>& lhs, const VectorArray<s32>& rhs) {
         RoundingShiftLeft(result, lhs, rhs);
     });
 }
 
 void EmitX64::EmitVectorRoundingShiftLeftU64(EmitContext& ctx, IR::Inst* inst) {
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tAVX2)) {
+        EmitVectorVariableShiftAVX(code, ctx, inst, 64, false, true);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u64>& result, const VectorArray<u64>& lhs, const VectorArray<s64>& rhs) {
         RoundingShiftLeft(result, lhs, rhs);
     });
@@ -3947,7 +4663,53 @@ void EmitX64::EmitVectorTableLookup(EmitContext& ctx, IR::Inst* inst) {
     const size_t table_size = std::count_if(table.begin(), table.end(), [](const auto& elem){ return !elem.IsVoid(); });
     const bool is_defaults_zero = !inst->GetArg(0).IsImmediate() && inst->GetArg(0).GetInst()->GetOpcode() == IR::Opcode::ZeroVector;
 
-    // TODO: AVX512VL implementation when available (VPERMB / VPERMI2B / VPERMT2B)
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tAVX512VL) && code.DoesCpuSupport(Xbyak::util::Cpu::tAVX512BW) && code.DoesCpuSupport(Xbyak::util::Cpu::tAVX512_VBMI)) {
+        const Xbyak::Xmm indicies = ctx.reg_alloc.UseXmm(args[2]);
+        const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+
+        // VPERMB only considers the low four bits of each index, and VPERMI2B the low five.
+        // Tables of three or four registers are looked up as two halves, selected by bit 5 of the index.
+        switch (table_size) {
+        case 1:
+            code.vpermb(result, indicies, ctx.reg_alloc.UseXmm(table[0]));
+            break;
+        case 2:
+            code.movaps(result, indicies);
+            code.vpermi2b(result, ctx.reg_alloc.UseXmm(table[0]), ctx.reg_alloc.UseXmm(table[1]));
+            break;
+        case 3:
+        case 4: {
+            const Xbyak::Xmm upper = ctx.reg_alloc.ScratchXmm();
+
+            code.movaps(result, indicies);
+            code.vpermi2b(result, ctx.reg_alloc.UseXmm(table[0]), ctx.reg_alloc.UseXmm(table[1]));
+            if (table_size == 3) {
+                code.vpermb(upper, indicies, ctx.reg_alloc.UseXmm(table[2]));
+            } else {
+                code.movaps(upper, indicies);
+                code.vpermi2b(upper, ctx.reg_alloc.UseXmm(table[2]), ctx.reg_alloc.UseXmm(table[3]));
+            }
+            code.vptestmb(k1, indicies, code.MConst(xword, 0x2020202020202020, 0x2020202020202020));
+            code.vmovdqu8(result | k1, upper);
+            break;
+        }
+        default:
+            UNREACHABLE();
+        }
+
+        // Out of range indices produce zero (TBL) or leave the default element unchanged (TBX).
+        // The VPCMPUB predicate 1 selects unsigned less-than.
+        const u64 table_limit = Common::Replicate<u64>(table_size * 16, 8);
+        code.vpcmpub(k1, indicies, code.MConst(xword, table_limit, table_limit), 1);
+        if (is_defaults_zero) {
+            code.vmovdqu8(result | k1 | T_z, result);
+        } else {
+            code.vpblendmb(result | k1, ctx.reg_alloc.UseXmm(args[0]), result);
+        }
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
 
     if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSSE3) && is_defaults_zero && table_size == 1) {
         const Xbyak::Xmm indicies = ctx.reg_alloc.UseScratchXmm(args[2]);
@@ -4030,6 +4792,44 @@ void EmitX64::EmitVectorTableLookup(EmitContext& ctx, IR::Inst* inst) {
         return;
     }
 
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSSE3)) {
+        const Xbyak::Xmm indicies = ctx.reg_alloc.UseScratchXmm(args[2]);
+        const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+        const Xbyak::Xmm in_range = ctx.reg_alloc.ScratchXmm();
+
+        const u64 table_max = Common::Replicate<u64>(table_size * 16 - 1, 8);
+        code.movaps(in_range, indicies);
+        code.pminub(in_range, code.MConst(xword, table_max, table_max));
+        code.pcmpeqb(in_range, indicies);
+
+        // Indices are rebased for each table in turn. Indices within that table are biased to 0x70..0x7F,
+        // while all others saturate to 0x80 or above, which PSHUFB maps to zero.
+        code.pxor(result, result);
+        for (size_t i = 0; i < table_size; ++i) {
+            const Xbyak::Xmm xmm_table = ctx.reg_alloc.UseScratchXmm(table[i]);
+
+            if (i != 0) {
+                code.psubb(indicies, code.MConst(xword, 0x1010101010101010, 0x1010101010101010));
+            }
+            code.movaps(xmm0, indicies);
+            code.paddusb(xmm0, code.MConst(xword, 0x7070707070707070, 0x7070707070707070));
+            code.pshufb(xmm_table, xmm0);
+            code.por(result, xmm_table);
+
+            ctx.reg_alloc.Release(xmm_table);
+        }
+
+        if (!is_defaults_zero) {
+            const Xbyak::Xmm defaults = ctx.reg_alloc.UseXmm(args[0]);
+
+            code.pandn(in_range, defaults);
+            code.por(result, in_range);
+        }
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
     const u32 stack_space = static_cast<u32>((table_size + 2) * 16);
     code.sub(rsp, stack_space + ABI_SHADOW_SPACE);
     for (size_t i = 0; i < table_size; ++i) {
@@ -4247,6 +5047,32 @@ void EmitX64::EmitVectorUnsignedMultiply32(EmitContext& ctx, IR::Inst* inst) {
 }
 
 void EmitX64::EmitVectorUnsignedRecipEstimate(EmitContext& ctx, IR::Inst* inst) {
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tAVX2)) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+        const Xbyak::Xmm a = ctx.reg_alloc.UseXmm(args[0]);
+        const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+        const Xbyak::Xmm index = ctx.reg_alloc.ScratchXmm();
+        const Xbyak::Xmm mask = ctx.reg_alloc.ScratchXmm();
+        const Xbyak::Reg64 table = ctx.reg_alloc.ScratchGpr();
+
+        code.vpsrld(index, a, 23);
+        code.vpand(index, index, code.MConst(xword, 0x000000FF000000FF, 0x000000FF000000FF));
+        code.vpcmpeqd(mask, mask, mask);
+        code.mov(table, reinterpret_cast<u64>(Common::RecipEstimateTable().data()));
+        code.vpgatherdd(result, code.ptr[table + index * 4], mask);
+        code.vpor(result, result, code.MConst(xword, 0x0000010000000100, 0x0000010000000100));
+        code.vpslld(result, result, 23);
+
+        // Lanes without the top bit set saturate to all-ones.
+        code.vpsrad(mask, a, 31);
+        code.vpandn(mask, mask, code.MConst(xword, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF));
+        code.vpor(result, result, mask);
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
     EmitOneArgumentFallback(code, ctx, inst, [](VectorArray<u32>& result, const VectorArray<u32>& a) {
         for (size_t i = 0; i < result.size(); i++) {
             if ((a[i] & 0x80000000) == 0) {
@@ -4263,6 +5089,32 @@ void EmitX64::EmitVectorUnsignedRecipEstimate(EmitContext& ctx, IR::Inst* inst)
 }
 
 void EmitX64::EmitVectorUnsignedRecipSqrtEstimate(EmitContext& ctx, IR::Inst* inst) {
+    if (code.DoesCpuSupport(Xbyak::util::Cpu::tAVX2)) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+        const Xbyak::Xmm a = ctx.reg_alloc.UseXmm(args[0]);
+        const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+        const Xbyak::Xmm index = ctx.reg_alloc.ScratchXmm();
+        const Xbyak::Xmm mask = ctx.reg_alloc.ScratchXmm();
+        const Xbyak::Reg64 table = ctx.reg_alloc.ScratchGpr();
+
+        code.vpsrld(index, a, 23);
+        code.vpcmpeqd(mask, mask, mask);
+        code.mov(table, reinterpret_cast<u64>(Common::RecipSqrtEstimateTable().data()));
+        code.vpgatherdd(result, code.ptr[table + index * 4], mask);
+        code.vpor(result, result, code.MConst(xword, 0x0000010000000100, 0x0000010000000100));
+        code.vpslld(result, result, 23);
+
+        // Lanes with neither of the top two bits set saturate to all-ones.
+        code.vpsrld(mask, a, 30);
+        code.vpxor(index, index, index);
+        code.vpcmpeqd(mask, mask, index);
+        code.vpor(result, result, mask);
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
     EmitOneArgumentFallback(code, ctx, inst, [](VectorArray<u32>& result, const VectorArray<u32>& a) {
         for (size_t i = 0; i < result.size(); i++) {
             if ((a[i] & 0xC0000000) == 0) {
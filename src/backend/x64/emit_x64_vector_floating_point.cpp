@@ -17,7 +17,9 @@
 #include "common/fp/fpcr.h"
 #include "common/fp/info.h"
 #include "common/fp/op.h"
+#include "common/fp/unpacked.h"
 #include "common/fp/util.h"
+#include "common/math_util.h"
 #include "common/mp/cartesian_product.h"
 #include "common/mp/function_info.h"
 #include "common/mp/integer.h"
@@ -81,7 +83,7 @@ private:
 
 template<size_t fsize, size_t nargs, typename NaNHandler>
 void HandleNaNs(BlockOfCode& code, EmitContext& ctx, std::array<Xbyak::Xmm, nargs + 1> xmms, const Xbyak::Xmm& nan_mask, NaNHandler nan_handler) {
-    static_assert(fsize == 32 || fsize == 64, "fsize must be either 32 or 64");
+    static_assert(fsize == 16 || fsize == 32 || fsize == 64, "fsize must be either 16, 32 or 64");
 
     if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSE41)) {
         code.ptest(nan_mask, nan_mask);
@@ -360,15 +362,9 @@ void EmitThreeOpVectorOperation(BlockOfCode& code, EmitContext& ctx, IR::Inst* i
 }
 
 template<typename Lambda>
-void EmitTwoOpFallback(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Lambda lambda) {
+void EmitTwoOpFallbackWithoutRegAlloc(BlockOfCode& code, EmitContext& ctx, Xbyak::Xmm result, Xbyak::Xmm arg1, Lambda lambda) {
     const auto fn = static_cast<mp::equivalent_function_type_t<Lambda>*>(lambda);
 
-    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    const Xbyak::Xmm arg1 = ctx.reg_alloc.UseXmm(args[0]);
-    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
-    ctx.reg_alloc.EndOfAllocScope();
-    ctx.reg_alloc.HostCall(nullptr);
-
     constexpr u32 stack_space = 2 * 16;
     code.sub(rsp, stack_space + ABI_SHADOW_SPACE);
     code.lea(code.ABI_PARAM1, ptr[rsp + ABI_SHADOW_SPACE + 0 * 16]);
@@ -381,6 +377,17 @@ void EmitTwoOpFallback(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Lamb
     code.movaps(result, xword[rsp + ABI_SHADOW_SPACE + 0 * 16]);
 
     code.add(rsp, stack_space + ABI_SHADOW_SPACE);
+}
+
+template<typename Lambda>
+void EmitTwoOpFallback(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Lambda lambda) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const Xbyak::Xmm arg1 = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    ctx.reg_alloc.EndOfAllocScope();
+    ctx.reg_alloc.HostCall(nullptr);
+
+    EmitTwoOpFallbackWithoutRegAlloc(code, ctx, result, arg1, lambda);
 
     ctx.reg_alloc.DefineValue(inst, result);
 }
@@ -435,6 +442,89 @@ void EmitThreeOpFallback(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, La
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
+/// Half-precision arithmetic is performed by widening each half of the vector to single precision with F16C.
+/// Single precision has at least 2 * 11 + 2 bits of precision, so rounding its result again to half precision
+/// gives the correctly rounded half-precision result for addition, subtraction and multiplication.
+/// The lambda fn(result, operand) performs the single-precision operation in-place on result.
+/// If a nan_handler is provided, it is used for all lanes with NaN results regardless of FPCR.DN.
+template<typename Function, typename Lambda>
+void EmitThreeOpVectorOperation16(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Function fn, Lambda fallback_fn,
+                                  NaNHandler<16, DefaultIndexer, 3>::function_type nan_handler = nullptr) {
+    if (!code.DoesCpuSupport(Xbyak::util::Cpu::tF16C) || ctx.FPCR().FZ16()) {
+        EmitThreeOpFallback(code, ctx, inst, fallback_fn);
+        return;
+    }
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm xmm_a = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm xmm_b = ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm upper = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    code.vcvtph2ps(result, xmm_a);
+    code.vcvtph2ps(tmp, xmm_b);
+    fn(result, tmp);
+    code.vpshufd(upper, xmm_a, 0b11101110);
+    code.vcvtph2ps(upper, upper);
+    code.vpshufd(tmp, xmm_b, 0b11101110);
+    code.vcvtph2ps(tmp, tmp);
+    fn(upper, tmp);
+
+    // Rounds according to MXCSR.RC, which mirrors FPCR.RMode.
+    code.vcvtps2ph(result, result, 0b100);
+    code.vcvtps2ph(upper, upper, 0b100);
+    code.vpunpcklqdq(result, result, upper);
+
+    const Xbyak::Xmm nan_mask = tmp;
+    code.vpand(nan_mask, result, code.MConst(xword, 0x7FFF7FFF7FFF7FFF, 0x7FFF7FFF7FFF7FFF));
+    code.vpcmpgtw(nan_mask, nan_mask, code.MConst(xword, 0x7C007C007C007C00, 0x7C007C007C007C00));
+
+    if (nan_handler) {
+        HandleNaNs<16, 2>(code, ctx, {result, xmm_a, xmm_b}, nan_mask, nan_handler);
+    } else if (!ctx.AccurateNaN() || ctx.FPCR().DN()) {
+        if (ctx.FPCR().DN()) {
+            code.vpblendvb(result, result, code.MConst(xword, 0x7E007E007E007E00, 0x7E007E007E007E00), nan_mask);
+        }
+    } else {
+        HandleNaNs<16, 2>(code, ctx, {result, xmm_a, xmm_b}, nan_mask, NaNHandler<16, DefaultIndexer, 3>::GetDefault());
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+/// Half-precision comparisons are performed by widening each half of the vector to single precision with F16C,
+/// which is exact. The lambda fn(result, operand) performs the single-precision comparison in-place on result,
+/// and the resulting doubleword masks are narrowed back to word masks with signed saturation.
+template<typename Function, typename Lambda>
+void EmitCompareVectorOperation16(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Function fn, Lambda fallback_fn) {
+    if (!code.DoesCpuSupport(Xbyak::util::Cpu::tF16C) || ctx.FPCR().FZ16()) {
+        EmitThreeOpFallback(code, ctx, inst, fallback_fn);
+        return;
+    }
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm xmm_a = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm xmm_b = ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm upper = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    code.vcvtph2ps(result, xmm_a);
+    code.vcvtph2ps(tmp, xmm_b);
+    fn(result, tmp);
+    code.vpshufd(upper, xmm_a, 0b11101110);
+    code.vcvtph2ps(upper, upper);
+    code.vpshufd(tmp, xmm_b, 0b11101110);
+    code.vcvtph2ps(tmp, tmp);
+    fn(upper, tmp);
+    code.vpackssdw(result, result, upper);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
 template<typename Lambda>
 void EmitFourOpFallbackWithoutRegAlloc(BlockOfCode& code, EmitContext& ctx, Xbyak::Xmm result, Xbyak::Xmm arg1, Xbyak::Xmm arg2, Xbyak::Xmm arg3, Lambda lambda) {
     const auto fn = static_cast<mp::equivalent_function_type_t<Lambda>*>(lambda);
@@ -460,6 +550,8 @@ void EmitFourOpFallbackWithoutRegAlloc(BlockOfCode& code, EmitContext& ctx, Xbya
     code.lea(code.ABI_PARAM6, code.ptr[code.r15 + code.GetJitStateInfo().offsetof_fpsr_exc]);
 #endif
 
+    // The current value of result is passed in too, so that lambda may leave some lanes untouched.
+    code.movaps(xword[code.ABI_PARAM1], result);
     code.movaps(xword[code.ABI_PARAM2], arg1);
     code.movaps(xword[code.ABI_PARAM3], arg2);
     code.movaps(xword[code.ABI_PARAM4], arg3);
@@ -489,6 +581,26 @@ void EmitFourOpFallback(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Lam
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
+/// Looks up the 8-bit estimate for each lane of index (one of the tables in math_util) with a gather,
+/// and places it in the top eight bits of the mantissa of the corresponding lane of result.
+/// Requires AVX2. Clobbers mask.
+template<size_t fsize, size_t table_size>
+void EmitEstimateTableLookup(BlockOfCode& code, Xbyak::Xmm result, Xbyak::Xmm index, Xbyak::Xmm mask, Xbyak::Reg64 table, const std::array<u32, table_size>& values) {
+    using FPT = mp::unsigned_integer_of_size<fsize>;
+    constexpr u8 mantissa_shift = static_cast<u8>(FP::FPInfo<FPT>::explicit_mantissa_width - 8);
+
+    code.vpcmpeqd(mask, mask, mask);
+    code.mov(table, reinterpret_cast<u64>(values.data()));
+    if constexpr (fsize == 32) {
+        code.vpgatherdd(result, code.ptr[table + index * 4], mask);
+        code.vpslld(result, result, mantissa_shift);
+    } else {
+        code.vpgatherqd(result, code.ptr[table + index * 4], mask);
+        code.vpmovzxdq(result, result);
+        code.vpsllq(result, result, mantissa_shift);
+    }
+}
+
 } // anonymous namespace
 
 void EmitX64::EmitFPVectorAbs16(EmitContext& ctx, IR::Inst* inst) {
@@ -524,6 +636,17 @@ void EmitX64::EmitFPVectorAbs64(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, a);
 }
 
+void EmitX64::EmitFPVectorAdd16(EmitContext& ctx, IR::Inst* inst) {
+    EmitThreeOpVectorOperation16(code, ctx, inst, [&](Xbyak::Xmm result, Xbyak::Xmm operand) {
+        code.vaddps(result, result, operand);
+    }, [](VectorArray<u16>& result, const VectorArray<u16>& op1, const VectorArray<u16>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        // op1 + op2 * 1.0 is op1 + op2 with a single rounding, with identical NaN and zero sign behaviour.
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = FP::FPMulAdd<u16>(op1[i], op2[i], FP::FPValue<u16, false, 0, 1>(), fpcr, fpsr);
+        }
+    });
+}
+
 void EmitX64::EmitFPVectorAdd32(EmitContext& ctx, IR::Inst* inst) {
     EmitThreeOpVectorOperation<32, DefaultIndexer>(code, ctx, inst, &Xbyak::CodeGenerator::addps);
 }
@@ -541,7 +664,9 @@ void EmitX64::EmitFPVectorDiv64(EmitContext& ctx, IR::Inst* inst) {
 }
 
 void EmitX64::EmitFPVectorEqual16(EmitContext& ctx, IR::Inst* inst) {
-    EmitThreeOpFallback(code, ctx, inst, [](VectorArray<u16>& result, const VectorArray<u16>& op1, const VectorArray<u16>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+    EmitCompareVectorOperation16(code, ctx, inst, [&](Xbyak::Xmm result, Xbyak::Xmm operand) {
+        code.vcmpeqps(result, result, operand);
+    }, [](VectorArray<u16>& result, const VectorArray<u16>& op1, const VectorArray<u16>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
         for (size_t i = 0; i < result.size(); i++) {
             result[i] = FP::FPCompareEQ(op1[i], op2[i], fpcr, fpsr) ? 0xFFFF : 0;
         }
@@ -743,6 +868,16 @@ void EmitX64::EmitFPVectorFromUnsignedFixed64(EmitContext& ctx, IR::Inst* inst)
     ctx.reg_alloc.DefineValue(inst, xmm);
 }
 
+void EmitX64::EmitFPVectorGreater16(EmitContext& ctx, IR::Inst* inst) {
+    EmitCompareVectorOperation16(code, ctx, inst, [&](Xbyak::Xmm result, Xbyak::Xmm operand) {
+        code.vcmpltps(result, operand, result);
+    }, [](VectorArray<u16>& result, const VectorArray<u16>& op1, const VectorArray<u16>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = FP::FPCompareGT(op1[i], op2[i], fpcr, fpsr) ? 0xFFFF : 0;
+        }
+    });
+}
+
 void EmitX64::EmitFPVectorGreater32(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     const Xbyak::Xmm a = ctx.reg_alloc.UseXmm(args[0]);
@@ -763,6 +898,16 @@ void EmitX64::EmitFPVectorGreater64(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, b);
 }
 
+void EmitX64::EmitFPVectorGreaterEqual16(EmitContext& ctx, IR::Inst* inst) {
+    EmitCompareVectorOperation16(code, ctx, inst, [&](Xbyak::Xmm result, Xbyak::Xmm operand) {
+        code.vcmpleps(result, operand, result);
+    }, [](VectorArray<u16>& result, const VectorArray<u16>& op1, const VectorArray<u16>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = FP::FPCompareGE(op1[i], op2[i], fpcr, fpsr) ? 0xFFFF : 0;
+        }
+    });
+}
+
 void EmitX64::EmitFPVectorGreaterEqual32(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     const Xbyak::Xmm a = ctx.reg_alloc.UseXmm(args[0]);
@@ -898,6 +1043,18 @@ void EmitX64::EmitFPVectorMin64(EmitContext& ctx, IR::Inst* inst) {
     EmitFPVectorMinMax<64, false>(code, ctx, inst);
 }
 
+void EmitX64::EmitFPVectorMul16(EmitContext& ctx, IR::Inst* inst) {
+    EmitThreeOpVectorOperation16(code, ctx, inst, [&](Xbyak::Xmm result, Xbyak::Xmm operand) {
+        code.vmulps(result, result, operand);
+    }, [](VectorArray<u16>& result, const VectorArray<u16>& op1, const VectorArray<u16>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        // Adding a zero with the same sign as the product leaves the product (and the sign of a zero product) unchanged.
+        for (size_t i = 0; i < result.size(); i++) {
+            const u16 zero = static_cast<u16>((op1[i] ^ op2[i]) & FP::FPInfo<u16>::sign_mask);
+            result[i] = FP::FPMulAdd<u16>(zero, op1[i], op2[i], fpcr, fpsr);
+        }
+    });
+}
+
 void EmitX64::EmitFPVectorMul32(EmitContext& ctx, IR::Inst* inst) {
     EmitThreeOpVectorOperation<32, DefaultIndexer>(code, ctx, inst, &Xbyak::CodeGenerator::mulps);
 }
@@ -916,7 +1073,94 @@ void EmitFPVectorMulAdd(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
         }
     };
 
-    if constexpr (fsize != 16) {
+    // Only lanes with NaN results, or results on the boundary of the normal range (where x86 and ARM
+    // differ in when tininess is detected), are recomputed in software.
+    const auto fixup_fn = [](VectorArray<FPT>& result, const VectorArray<FPT>& addend, const VectorArray<FPT>& op1, const VectorArray<FPT>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        constexpr FPT smallest_normal_number = FP::FPValue<FPT, false, FP::FPInfo<FPT>::exponent_min, 1>();
+        for (size_t i = 0; i < result.size(); i++) {
+            const FPT abs_result = static_cast<FPT>(result[i] & ~FP::FPInfo<FPT>::sign_mask);
+            if (FP::IsNaN(result[i]) || abs_result == smallest_normal_number) {
+                result[i] = FP::FPMulAdd<FPT>(addend[i], op1[i], op2[i], fpcr, fpsr);
+            }
+        }
+    };
+
+    if constexpr (fsize == 16) {
+        if (code.DoesCpuSupport(Xbyak::util::Cpu::tF16C) && !ctx.FPCR().FZ16()) {
+            // A single-precision fused multiply-add would round twice to nearest, which is not always correct.
+            // Instead each pair of lanes is widened to double precision, in which the product is exact, so the
+            // sum is the only rounding. The sum is rounded to single precision with round-to-odd (truncating,
+            // then setting the lowest bit if any discarded bits were set), which vcvtps2ph can then correctly
+            // round to half precision. No intermediate step raises an exception the final result would not.
+            auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+            const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+            const Xbyak::Xmm xmm_a = ctx.reg_alloc.UseXmm(args[0]);
+            const Xbyak::Xmm xmm_b = ctx.reg_alloc.UseXmm(args[1]);
+            const Xbyak::Xmm xmm_c = ctx.reg_alloc.UseXmm(args[2]);
+            const Xbyak::Xmm sum = ctx.reg_alloc.ScratchXmm();
+            const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+            const Xbyak::Xmm singles = ctx.reg_alloc.ScratchXmm();
+
+            const auto widen_pair = [&](Xbyak::Xmm dest, Xbyak::Xmm source, size_t pair) {
+                if (pair == 0) {
+                    code.vcvtph2ps(dest, source);
+                } else {
+                    code.vpsrldq(dest, source, static_cast<u8>(pair * 4));
+                    code.vcvtph2ps(dest, dest);
+                }
+                code.vcvtps2pd(dest, dest);
+            };
+
+            Xbyak::Label end, fallback;
+
+            for (size_t pair = 0; pair < 4; pair++) {
+                widen_pair(sum, xmm_b, pair);
+                widen_pair(tmp, xmm_c, pair);
+                code.vmulpd(sum, sum, tmp);
+                widen_pair(tmp, xmm_a, pair);
+                code.vaddpd(sum, sum, tmp);
+
+                code.vandpd(tmp, sum, code.MConst(xword, 0xFFFFFFFFE0000000, 0xFFFFFFFFE0000000));
+                code.vcmpneqpd(sum, sum, tmp);
+                code.vandpd(sum, sum, code.MConst(xword, 0x0000000020000000, 0x0000000020000000));
+                code.vorpd(sum, sum, tmp);
+                code.vcvtpd2ps(sum, sum);
+
+                if (pair % 2 == 0) {
+                    code.vmovaps(singles, sum);
+                } else if (pair == 1) {
+                    code.vmovlhps(singles, singles, sum);
+                    code.vcvtps2ph(result, singles, 0b100);
+                } else {
+                    code.vmovlhps(singles, singles, sum);
+                    code.vcvtps2ph(singles, singles, 0b100);
+                    code.vpunpcklqdq(result, result, singles);
+                }
+            }
+
+            code.vpand(tmp, result, code.MConst(xword, 0x7FFF7FFF7FFF7FFF, 0x7FFF7FFF7FFF7FFF));
+            code.vpcmpgtw(sum, tmp, code.MConst(xword, 0x7C007C007C007C00, 0x7C007C007C007C00));
+            code.vpcmpeqw(tmp, tmp, code.MConst(xword, 0x0400040004000400, 0x0400040004000400));
+            code.vpor(tmp, tmp, sum);
+            code.vptest(tmp, tmp);
+            code.jnz(fallback, code.T_NEAR);
+            code.L(end);
+
+            code.SwitchToFarCode();
+            code.L(fallback);
+            code.sub(rsp, 8);
+            ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+            EmitFourOpFallbackWithoutRegAlloc(code, ctx, result, xmm_a, xmm_b, xmm_c, fixup_fn);
+            ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+            code.add(rsp, 8);
+            code.jmp(end, code.T_NEAR);
+            code.SwitchToNearCode();
+
+            ctx.reg_alloc.DefineValue(inst, result);
+            return;
+        }
+    } else {
         if (code.DoesCpuSupport(Xbyak::util::Cpu::tFMA) && code.DoesCpuSupport(Xbyak::util::Cpu::tAVX)) {
             auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
@@ -940,9 +1184,23 @@ void EmitFPVectorMulAdd(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
 
             code.SwitchToFarCode();
             code.L(fallback);
+            if (ctx.FPCR().DN()) {
+                // NaN lanes only need to be replaced with the default NaN, unless the addend is a NaN:
+                // (inf * 0) + qNaN must signal Invalid Operation, which x86 does not do.
+                FCODE(vcmpunordp)(xmm0, result, result);
+                FCODE(blendvp)(result, GetNaNVector<fsize>(code));
+
+                code.movaps(tmp, GetNegativeZeroVector<fsize>(code));
+                code.andnps(tmp, result);
+                FCODE(vcmpeqp)(tmp, tmp, GetSmallestNormalVector<fsize>(code));
+                FCODE(vcmpunordp)(xmm0, xmm_a, xmm_a);
+                code.vorps(tmp, tmp, xmm0);
+                code.vptest(tmp, tmp);
+                code.jz(end, code.T_NEAR);
+            }
             code.sub(rsp, 8);
             ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
-            EmitFourOpFallbackWithoutRegAlloc(code, ctx, result, xmm_a, xmm_b, xmm_c, fallback_fn);
+            EmitFourOpFallbackWithoutRegAlloc(code, ctx, result, xmm_a, xmm_b, xmm_c, fixup_fn);
             ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
             code.add(rsp, 8);
             code.jmp(end, code.T_NEAR);
@@ -968,10 +1226,29 @@ void EmitX64::EmitFPVectorMulAdd64(EmitContext& ctx, IR::Inst* inst) {
     EmitFPVectorMulAdd<64>(code, ctx, inst);
 }
 
+/// Lanes of a product with a NaN result either propagate a NaN operand, or are infinity times zero,
+/// for which FMULX returns two with the sign of the product.
 template<size_t fsize>
-static void EmitFPVectorMulX(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+static typename NaNHandler<fsize, DefaultIndexer, 3>::function_type GetMulXNaNHandler() {
     using FPT = mp::unsigned_integer_of_size<fsize>;
 
+    return static_cast<typename NaNHandler<fsize, DefaultIndexer, 3>::function_type>(
+        [](std::array<VectorArray<FPT>, 3>& values, FP::FPCR fpcr) {
+            VectorArray<FPT>& result = values[0];
+            for (size_t elementi = 0; elementi < result.size(); ++elementi) {
+                if (auto r = FP::ProcessNaNs(values[1][elementi], values[2][elementi])) {
+                    result[elementi] = fpcr.DN() ? FP::FPInfo<FPT>::DefaultNaN() : *r;
+                } else if (FP::IsNaN(result[elementi])) {
+                    const FPT sign = (values[1][elementi] ^ values[2][elementi]) & FP::FPInfo<FPT>::sign_mask;
+                    result[elementi] = sign | FP::FPValue<FPT, false, 0, 2>();
+                }
+            }
+        }
+    );
+}
+
+template<size_t fsize>
+static void EmitFPVectorMulX(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
     if (ctx.FPCR().DN() && code.DoesCpuSupport(Xbyak::util::Cpu::tAVX)) {
@@ -1005,25 +1282,28 @@ static void EmitFPVectorMulX(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst
     FCODE(mulp)(result, xmm_b);
     FCODE(cmpunordp)(nan_mask, result);
 
-    const auto nan_handler = static_cast<void(*)(std::array<VectorArray<FPT>, 3>&, FP::FPCR)>(
-        [](std::array<VectorArray<FPT>, 3>& values, FP::FPCR fpcr) {
-            VectorArray<FPT>& result = values[0];
-            for (size_t elementi = 0; elementi < result.size(); ++elementi) {
-                if (auto r = FP::ProcessNaNs(values[1][elementi], values[2][elementi])) {
-                    result[elementi] = fpcr.DN() ? FP::FPInfo<FPT>::DefaultNaN() : *r;
-                } else if (FP::IsNaN(result[elementi])) {
-                    const FPT sign = (values[1][elementi] ^ values[2][elementi]) & FP::FPInfo<FPT>::sign_mask;
-                    result[elementi] = sign | FP::FPValue<FPT, false, 0, 2>();
-                }
-            }
-        }
-    );
-
-    HandleNaNs<fsize, 2>(code, ctx, {result, xmm_a, xmm_b}, nan_mask, nan_handler);
+    HandleNaNs<fsize, 2>(code, ctx, {result, xmm_a, xmm_b}, nan_mask, GetMulXNaNHandler<fsize>());
 
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
+void EmitX64::EmitFPVectorMulX16(EmitContext& ctx, IR::Inst* inst) {
+    EmitThreeOpVectorOperation16(code, ctx, inst, [&](Xbyak::Xmm result, Xbyak::Xmm operand) {
+        code.vmulps(result, result, operand);
+    }, [](VectorArray<u16>& result, const VectorArray<u16>& op1, const VectorArray<u16>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        for (size_t i = 0; i < result.size(); i++) {
+            const auto type1 = std::get<FP::FPType>(FP::FPUnpack<u16>(op1[i], fpcr, fpsr));
+            const auto type2 = std::get<FP::FPType>(FP::FPUnpack<u16>(op2[i], fpcr, fpsr));
+            const u16 sign = static_cast<u16>((op1[i] ^ op2[i]) & FP::FPInfo<u16>::sign_mask);
+            if ((type1 == FP::FPType::Infinity && type2 == FP::FPType::Zero) || (type1 == FP::FPType::Zero && type2 == FP::FPType::Infinity)) {
+                result[i] = sign | FP::FPValue<u16, false, 0, 2>();
+            } else {
+                result[i] = FP::FPMulAdd<u16>(sign, op1[i], op2[i], fpcr, fpsr);
+            }
+        }
+    }, GetMulXNaNHandler<16>());
+}
+
 void EmitX64::EmitFPVectorMulX32(EmitContext& ctx, IR::Inst* inst) {
     EmitFPVectorMulX<32>(code, ctx, inst);
 }
@@ -1093,11 +1373,80 @@ void EmitX64::EmitFPVectorPairedAddLower64(EmitContext& ctx, IR::Inst* inst) {
 
 template<typename FPT>
 static void EmitRecipEstimate(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
-    EmitTwoOpFallback(code, ctx, inst, [](VectorArray<FPT>& result, const VectorArray<FPT>& operand, FP::FPCR fpcr, FP::FPSR& fpsr) {
+    const auto fallback_fn = [](VectorArray<FPT>& result, const VectorArray<FPT>& operand, FP::FPCR fpcr, FP::FPSR& fpsr) {
         for (size_t i = 0; i < result.size(); i++) {
             result[i] = FP::FPRecipEstimate<FPT>(operand[i], fpcr, fpsr);
         }
-    });
+    };
+
+    if constexpr (!std::is_same_v<FPT, u16>) {
+        if (code.DoesCpuSupport(Xbyak::util::Cpu::tAVX2)) {
+            constexpr size_t fsize = FP::FPInfo<FPT>::total_width;
+            constexpr u8 mantissa_width = static_cast<u8>(FP::FPInfo<FPT>::explicit_mantissa_width);
+            constexpr u64 bias = FP::FPInfo<FPT>::exponent_bias;
+            constexpr u64 sign_mask = FP::FPInfo<FPT>::sign_mask;
+            constexpr u64 exponent_mask = FP::FPInfo<FPT>::exponent_mask;
+
+            auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+            Xbyak::Label end, fallback;
+
+            const Xbyak::Xmm operand = ctx.reg_alloc.UseXmm(args[0]);
+            const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+            const Xbyak::Xmm exponent = ctx.reg_alloc.ScratchXmm();
+            const Xbyak::Xmm index = ctx.reg_alloc.ScratchXmm();
+            const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+            const Xbyak::Reg64 table = ctx.reg_alloc.ScratchGpr();
+
+            // Lanes are handled inline when 1 <= exponent <= 2 * bias - 2, i.e.: both the input and
+            // the estimate are normal. The range check is done with a signed comparison after biasing.
+            code.vpand(exponent, operand, GetVectorOf<fsize, exponent_mask>(code));
+            if constexpr (fsize == 32) {
+                code.vpaddd(tmp, exponent, GetVectorOf<fsize, sign_mask - (u64(1) << mantissa_width)>(code));
+                code.vpcmpgtd(tmp, tmp, GetVectorOf<fsize, sign_mask + ((2 * bias - 3) << mantissa_width)>(code));
+            } else {
+                code.vpaddq(tmp, exponent, GetVectorOf<fsize, sign_mask - (u64(1) << mantissa_width)>(code));
+                code.vpcmpgtq(tmp, tmp, GetVectorOf<fsize, sign_mask + ((2 * bias - 3) << mantissa_width)>(code));
+            }
+            code.vptest(tmp, tmp);
+            code.jnz(fallback, code.T_NEAR);
+
+            if constexpr (fsize == 32) {
+                code.vpsrld(index, operand, mantissa_width - 8);
+            } else {
+                code.vpsrlq(index, operand, mantissa_width - 8);
+            }
+            code.vpand(index, index, GetVectorOf<fsize, 0xFF>(code));
+            EmitEstimateTableLookup<fsize>(code, result, index, tmp, table, Common::RecipEstimateTable());
+
+            // The result exponent is 2 * bias - 1 - exponent; the sign is preserved.
+            code.vmovdqa(tmp, GetVectorOf<fsize, (2 * bias - 1) << mantissa_width>(code));
+            if constexpr (fsize == 32) {
+                code.vpsubd(tmp, tmp, exponent);
+            } else {
+                code.vpsubq(tmp, tmp, exponent);
+            }
+            code.vpor(result, result, tmp);
+            code.vpand(tmp, operand, GetVectorOf<fsize, sign_mask>(code));
+            code.vpor(result, result, tmp);
+            code.L(end);
+
+            code.SwitchToFarCode();
+            code.L(fallback);
+            code.sub(rsp, 8);
+            ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+            EmitTwoOpFallbackWithoutRegAlloc(code, ctx, result, operand, fallback_fn);
+            ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+            code.add(rsp, 8);
+            code.jmp(end, code.T_NEAR);
+            code.SwitchToNearCode();
+
+            ctx.reg_alloc.DefineValue(inst, result);
+            return;
+        }
+    }
+
+    EmitTwoOpFallback(code, ctx, inst, fallback_fn);
 }
 
 void EmitX64::EmitFPVectorRecipEstimate16(EmitContext& ctx, IR::Inst* inst) {
@@ -1179,7 +1528,7 @@ void EmitFPVectorRoundInt(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
     const bool exact = inst->GetArg(2).GetU1();
 
     if constexpr (fsize != 16) {
-        if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSE41) && rounding != FP::RoundingMode::ToNearest_TieAwayFromZero && !exact) {
+        if (code.DoesCpuSupport(Xbyak::util::Cpu::tSSE41) && rounding != FP::RoundingMode::ToNearest_TieAwayFromZero) {
             const u8 round_imm = [&]() -> u8 {
                 switch (rounding) {
                 case FP::RoundingMode::ToNearest_TieEven:
@@ -1196,8 +1545,11 @@ void EmitFPVectorRoundInt(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
                 return 0;
             }();
 
+            // Bit 3 of the immediate suppresses the precision exception, which is reported as FPSR.IXC.
+            const u8 inexact_imm = exact ? 0b0000 : 0b1000;
+
             EmitTwoOpVectorOperation<fsize, DefaultIndexer>(code, ctx, inst, [&](const Xbyak::Xmm& result, const Xbyak::Xmm& xmm_a){
-                FCODE(roundp)(result, xmm_a, round_imm);
+                FCODE(roundp)(result, xmm_a, static_cast<u8>(round_imm | inexact_imm));
             });
 
             return;
@@ -1252,11 +1604,90 @@ void EmitX64::EmitFPVectorRoundInt64(EmitContext& ctx, IR::Inst* inst) {
 
 template<typename FPT>
 static void EmitRSqrtEstimate(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
-    EmitTwoOpFallback(code, ctx, inst, [](VectorArray<FPT>& result, const VectorArray<FPT>& operand, FP::FPCR fpcr, FP::FPSR& fpsr) {
+    const auto fallback_fn = [](VectorArray<FPT>& result, const VectorArray<FPT>& operand, FP::FPCR fpcr, FP::FPSR& fpsr) {
         for (size_t i = 0; i < result.size(); i++) {
             result[i] = FP::FPRSqrtEstimate<FPT>(operand[i], fpcr, fpsr);
         }
-    });
+    };
+
+    if constexpr (!std::is_same_v<FPT, u16>) {
+        if (code.DoesCpuSupport(Xbyak::util::Cpu::tAVX2)) {
+            constexpr size_t fsize = FP::FPInfo<FPT>::total_width;
+            constexpr u8 mantissa_width = static_cast<u8>(FP::FPInfo<FPT>::explicit_mantissa_width);
+            constexpr u64 bias = FP::FPInfo<FPT>::exponent_bias;
+            constexpr u64 sign_mask = FP::FPInfo<FPT>::sign_mask;
+
+            auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+            Xbyak::Label end, fallback;
+
+            const Xbyak::Xmm operand = ctx.reg_alloc.UseXmm(args[0]);
+            const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+            const Xbyak::Xmm exponent = ctx.reg_alloc.ScratchXmm();
+            const Xbyak::Xmm index = ctx.reg_alloc.ScratchXmm();
+            const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+            const Xbyak::Reg64 table = ctx.reg_alloc.ScratchGpr();
+
+            // Lanes are handled inline when they are positive and normal, i.e.: when the sign and
+            // exponent fields taken together lie in [1, 2 * bias].
+            if constexpr (fsize == 32) {
+                code.vpsrld(exponent, operand, mantissa_width);
+                code.vpaddd(tmp, exponent, GetVectorOf<fsize, sign_mask - 1>(code));
+                code.vpcmpgtd(tmp, tmp, GetVectorOf<fsize, sign_mask + 2 * bias - 1>(code));
+            } else {
+                code.vpsrlq(exponent, operand, mantissa_width);
+                code.vpaddq(tmp, exponent, GetVectorOf<fsize, sign_mask - 1>(code));
+                code.vpcmpgtq(tmp, tmp, GetVectorOf<fsize, sign_mask + 2 * bias - 1>(code));
+            }
+            code.vptest(tmp, tmp);
+            code.jnz(fallback, code.T_NEAR);
+
+            // The table index is the leading nine bits of the mantissa (including the implicit bit),
+            // shifted right by one more when the exponent is odd.
+            code.vpand(tmp, exponent, GetVectorOf<fsize, 1>(code));
+            if constexpr (fsize == 32) {
+                code.vpsrld(index, operand, mantissa_width - 8);
+                code.vpand(index, index, GetVectorOf<fsize, 0xFF>(code));
+                code.vpor(index, index, GetVectorOf<fsize, 0x100>(code));
+                code.vpsrlvd(index, index, tmp);
+            } else {
+                code.vpsrlq(index, operand, mantissa_width - 8);
+                code.vpand(index, index, GetVectorOf<fsize, 0xFF>(code));
+                code.vpor(index, index, GetVectorOf<fsize, 0x100>(code));
+                code.vpsrlvq(index, index, tmp);
+            }
+            EmitEstimateTableLookup<fsize>(code, result, index, tmp, table, Common::RecipSqrtEstimateTable());
+
+            // The result exponent is (3 * bias - 1 - exponent) / 2.
+            code.vmovdqa(tmp, GetVectorOf<fsize, 3 * bias - 1>(code));
+            if constexpr (fsize == 32) {
+                code.vpsubd(tmp, tmp, exponent);
+                code.vpsrld(tmp, tmp, 1);
+                code.vpslld(tmp, tmp, mantissa_width);
+            } else {
+                code.vpsubq(tmp, tmp, exponent);
+                code.vpsrlq(tmp, tmp, 1);
+                code.vpsllq(tmp, tmp, mantissa_width);
+            }
+            code.vpor(result, result, tmp);
+            code.L(end);
+
+            code.SwitchToFarCode();
+            code.L(fallback);
+            code.sub(rsp, 8);
+            ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+            EmitTwoOpFallbackWithoutRegAlloc(code, ctx, result, operand, fallback_fn);
+            ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+            code.add(rsp, 8);
+            code.jmp(end, code.T_NEAR);
+            code.SwitchToNearCode();
+
+            ctx.reg_alloc.DefineValue(inst, result);
+            return;
+        }
+    }
+
+    EmitTwoOpFallback(code, ctx, inst, fallback_fn);
 }
 
 void EmitX64::EmitFPVectorRSqrtEstimate16(EmitContext& ctx, IR::Inst* inst) {
@@ -1352,6 +1783,17 @@ void EmitX64::EmitFPVectorSqrt64(EmitContext& ctx, IR::Inst* inst) {
     });
 }
 
+void EmitX64::EmitFPVectorSub16(EmitContext& ctx, IR::Inst* inst) {
+    EmitThreeOpVectorOperation16(code, ctx, inst, [&](Xbyak::Xmm result, Xbyak::Xmm operand) {
+        code.vsubps(result, result, operand);
+    }, [](VectorArray<u16>& result, const VectorArray<u16>& op1, const VectorArray<u16>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        // op1 + op2 * -1.0 is op1 - op2 with a single rounding; NaNs in op2 are propagated without negation, as with FPSub.
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = FP::FPMulAdd<u16>(op1[i], op2[i], FP::FPValue<u16, true, 0, 1>(), fpcr, fpsr);
+        }
+    });
+}
+
 void EmitX64::EmitFPVectorSub32(EmitContext& ctx, IR::Inst* inst) {
     EmitThreeOpVectorOperation<32, DefaultIndexer>(code, ctx, inst, &Xbyak::CodeGenerator::subps);
 }
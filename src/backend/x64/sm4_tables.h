@@ -0,0 +1,54 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#pragma once
+
+#include <array>
+
+#include "common/common_types.h"
+
+namespace Dynarmic::BackendX64::SM4Tables {
+
+// The SM4 S-box is an affine transform of an inversion in GF(2^8) (modulo x^8+x^7+x^6+x^5+x^4+x^2+1),
+// followed by the same affine transform. As all fields of order 2^8 are isomorphic, the transforms
+// below map to and from the AES field (modulo x^8+x^4+x^3+x+1), allowing the use of host AES and GFNI
+// instructions.
+
+// GF2P8AFFINEQB matrices and constants.
+constexpr u64 gfni_pre_matrix = 0x4C287DB91A22505D;
+constexpr u8 gfni_pre_constant = 0x3E;
+constexpr u64 gfni_post_matrix = 0xF3AB34A974A6B589;
+constexpr u8 gfni_post_constant = 0xD3;
+
+// The same transforms as nibble lookup tables for PSHUFB. The post-transform table additionally
+// undoes the affine transform applied by AES SubBytes.
+constexpr std::array<u64, 2> aes_pre_low_nibble{0x078B37BB820EB23E, 0x9814A8241D912DA1};
+constexpr std::array<u64, 2> aes_pre_high_nibble{0x37EB19C5F22EDC00, 0x3FE311CDFA26D408};
+constexpr std::array<u64, 2> aes_post_low_nibble{0x2098EA521EA6D46C, 0x47FF8D3579C1B30B};
+constexpr std::array<u64, 2> aes_post_high_nibble{0x2DCD7D9DB050E000, 0xED0DBD5D709020C0};
+constexpr std::array<u64, 2> aes_inverse_shift_rows{0x0B0E0104070A0D00, 0x0306090C0F020508};
+
+// The S-box itself, in sixteen rows of sixteen bytes.
+constexpr std::array<std::array<u64, 2>, 16> substitution_box_rows{{
+    {0xB73DE1CCFEE990D6, 0x052CFB28C214B616},
+    {0xC304BE2A769A672B, 0x99068649261344AA},
+    {0x7A98EF91F450429C, 0x62ACCFED430B5433},
+    {0x95E808C9A91CB3E4, 0xA63F8F75FA94DF80},
+    {0xBA1773F3FCA70747, 0xA84F85E6193C5983},
+    {0x8BDA6471B2816B68, 0x359D56704B0FEBF8},
+    {0xA2D158635E0E241E, 0x877821013B7C2225},
+    {0x5227D39F574600D4, 0x9EC8C4A0E702364C},
+    {0xB538C740D28ABFEA, 0xA11561F9CEF2F7A3},
+    {0x551A349BA45DAEE0, 0xE3B18CF5303293AD},
+    {0x60CA66822EE2F61D, 0x6F4E530DAB2329C0},
+    {0x2F8EFDDE4537DBD5, 0x515B6C6D726AFF03},
+    {0x7FBCDDBB92AF1B8D, 0xD85A101F415CD911},
+    {0xBD7BCDA58831C10A, 0xB0B4E5B812D0742D},
+    {0x7E77960C4A976989, 0x84C66EC509F1B965},
+    {0x204DDC3AEC7DF018, 0x4839CBD73E5FEE79},
+}};
+
+} // namespace Dynarmic::BackendX64::SM4Tables
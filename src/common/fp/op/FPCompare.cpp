@@ -4,6 +4,8 @@
  * General Public License version 2 or any later version.
  */
 
+#include <tuple>
+
 #include "common/fp/fpcr.h"
 #include "common/fp/fpsr.h"
 #include "common/fp/op/FPCompare.h"
@@ -11,6 +13,42 @@
 #include "common/fp/unpacked.h"
 
 namespace Dynarmic::FP {
+namespace {
+
+/// Returns true if value1 < value2. Neither value may be a NaN.
+bool IsLessThan(FPType type1, const FPUnpacked& value1, FPType type2, const FPUnpacked& value2) {
+    if (type1 == FPType::Zero && type2 == FPType::Zero) {
+        return false;
+    }
+
+    if (value1.sign != value2.sign) {
+        return value1.sign;
+    }
+
+    // Zeros are unpacked with a zero exponent, so have to be explicitly ordered below every other magnitude.
+    const auto magnitude = [](FPType type, const FPUnpacked& value) {
+        return std::make_tuple(type != FPType::Zero, value.exponent, value.mantissa);
+    };
+    return value1.sign ? magnitude(type2, value2) < magnitude(type1, value1)
+                       : magnitude(type1, value1) < magnitude(type2, value2);
+}
+
+/// Implements the ordered (signalling) comparisons, which raise Invalid Operation for any NaN operand.
+template <typename FPT, typename Predicate>
+bool FPCompareOrdered(FPT lhs, FPT rhs, FPCR fpcr, FPSR& fpsr, Predicate predicate) {
+    const auto [type1, sign1, value1] = FPUnpack(lhs, fpcr, fpsr);
+    const auto [type2, sign2, value2] = FPUnpack(rhs, fpcr, fpsr);
+
+    if (type1 == FPType::QNaN || type1 == FPType::SNaN ||
+        type2 == FPType::QNaN || type2 == FPType::SNaN) {
+        FPProcessException(FPExc::InvalidOp, fpcr, fpsr);
+        return false;
+    }
+
+    return predicate(type1, value1, type2, value2);
+}
+
+} // anonymous namespace
 
 template <typename FPT>
 bool FPCompareEQ(FPT lhs, FPT rhs, FPCR fpcr, FPSR& fpsr) {
@@ -38,4 +76,26 @@ template bool FPCompareEQ<u16>(u16 lhs, u16 rhs, FPCR fpcr, FPSR& fpsr);
 template bool FPCompareEQ<u32>(u32 lhs, u32 rhs, FPCR fpcr, FPSR& fpsr);
 template bool FPCompareEQ<u64>(u64 lhs, u64 rhs, FPCR fpcr, FPSR& fpsr);
 
+template <typename FPT>
+bool FPCompareGE(FPT lhs, FPT rhs, FPCR fpcr, FPSR& fpsr) {
+    return FPCompareOrdered(lhs, rhs, fpcr, fpsr, [](FPType type1, const FPUnpacked& value1, FPType type2, const FPUnpacked& value2) {
+        return !IsLessThan(type1, value1, type2, value2);
+    });
+}
+
+template bool FPCompareGE<u16>(u16 lhs, u16 rhs, FPCR fpcr, FPSR& fpsr);
+template bool FPCompareGE<u32>(u32 lhs, u32 rhs, FPCR fpcr, FPSR& fpsr);
+template bool FPCompareGE<u64>(u64 lhs, u64 rhs, FPCR fpcr, FPSR& fpsr);
+
+template <typename FPT>
+bool FPCompareGT(FPT lhs, FPT rhs, FPCR fpcr, FPSR& fpsr) {
+    return FPCompareOrdered(lhs, rhs, fpcr, fpsr, [](FPType type1, const FPUnpacked& value1, FPType type2, const FPUnpacked& value2) {
+        return IsLessThan(type2, value2, type1, value1);
+    });
+}
+
+template bool FPCompareGT<u16>(u16 lhs, u16 rhs, FPCR fpcr, FPSR& fpsr);
+template bool FPCompareGT<u32>(u32 lhs, u32 rhs, FPCR fpcr, FPSR& fpsr);
+template bool FPCompareGT<u64>(u64 lhs, u64 rhs, FPCR fpcr, FPSR& fpsr);
+
 } // namespace Dynarmic::FP
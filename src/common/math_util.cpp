@@ -65,4 +65,26 @@ u8 RecipSqrtEstimate(u64 a) {
     return lut[a & 0x1FF];
 }
 
+const std::array<u32, 256>& RecipEstimateTable() {
+    static const std::array<u32, 256> table = [] {
+        std::array<u32, 256> result{};
+        for (u64 i = 0; i < result.size(); i++) {
+            result[i] = RecipEstimate(i + 256);
+        }
+        return result;
+    }();
+    return table;
+}
+
+const std::array<u32, 512>& RecipSqrtEstimateTable() {
+    static const std::array<u32, 512> table = [] {
+        std::array<u32, 512> result{};
+        for (u64 i = 128; i < result.size(); i++) {
+            result[i] = RecipSqrtEstimate(i);
+        }
+        return result;
+    }();
+    return table;
+}
+
 } // namespace Dynarmic::Common
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <array>
 #include <utility>
 
 #include "common/common_types.h"
@@ -45,4 +46,14 @@ u8 RecipEstimate(u64 a);
  */
 u8 RecipSqrtEstimate(u64 a);
 
+/**
+ * The lookup tables behind RecipEstimate and RecipSqrtEstimate, for use by generated code.
+ * Entries are widened to 32 bits so that they can be fetched with gather instructions.
+ *
+ * RecipEstimateTable()[i] == RecipEstimate(256 + i) for i in [0, 256).
+ * RecipSqrtEstimateTable()[i] == RecipSqrtEstimate(i) for i in [128, 512).
+ */
+const std::array<u32, 256>& RecipEstimateTable();
+const std::array<u32, 512>& RecipSqrtEstimateTable();
+
 } // namespace Dynarmic::Common
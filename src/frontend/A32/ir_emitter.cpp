@@ -42,6 +42,11 @@ IR::U32U64 IREmitter::GetExtendedRegister(ExtReg reg) {
     ASSERT_MSG(false, "Invalid reg.");
 }
 
+IR::U128 IREmitter::GetVector(ExtReg reg) {
+    ASSERT(A32::IsDoubleExtReg(reg) || A32::IsQuadExtReg(reg));
+    return Inst<IR::U128>(Opcode::A32GetVector, IR::Value(reg));
+}
+
 void IREmitter::SetRegister(const Reg reg, const IR::U32& value) {
     ASSERT(reg != A32::Reg::PC);
     Inst(Opcode::A32SetRegister, IR::Value(reg), value);
@@ -57,6 +62,11 @@ void IREmitter::SetExtendedRegister(const ExtReg reg, const IR::U32U64& value) {
     }
 }
 
+void IREmitter::SetVector(ExtReg reg, const IR::U128& value) {
+    ASSERT(A32::IsDoubleExtReg(reg) || A32::IsQuadExtReg(reg));
+    Inst(Opcode::A32SetVector, IR::Value(reg), value);
+}
+
 void IREmitter::ALUWritePC(const IR::U32& value) {
     // This behaviour is ARM version-dependent.
     // The below implementation is for ARMv6k
@@ -0,0 +1,218 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include <array>
+#include <optional>
+#include <tuple>
+
+#include "common/assert.h"
+#include "common/bit_util.h"
+#include "frontend/A32/translate/impl/translate_arm.h"
+
+namespace Dynarmic::A32 {
+namespace {
+
+/// Returns the (nelem, regs, inc) triple associated with a VLDn/VSTn (multiple structures) type field.
+std::optional<std::tuple<size_t, size_t, size_t>> DecodeType(Imm<4> type, size_t size, size_t align) {
+    switch (type.ZeroExtend()) {
+    case 0b0111: // VST1 A1 / VLD1 A1
+        if (Common::Bit<1>(align)) {
+            return std::nullopt;
+        }
+        return std::tuple<size_t, size_t, size_t>{1, 1, 0};
+    case 0b1010: // VST1 A2 / VLD1 A2
+        if (align == 0b11) {
+            return std::nullopt;
+        }
+        return std::tuple<size_t, size_t, size_t>{1, 2, 0};
+    case 0b0110: // VST1 A3 / VLD1 A3
+        if (Common::Bit<1>(align)) {
+            return std::nullopt;
+        }
+        return std::tuple<size_t, size_t, size_t>{1, 3, 0};
+    case 0b0010: // VST1 A4 / VLD1 A4
+        return std::tuple<size_t, size_t, size_t>{1, 4, 0};
+    case 0b1000: // VST2 A1 / VLD2 A1
+        if (size == 0b11 || align == 0b11) {
+            return std::nullopt;
+        }
+        return std::tuple<size_t, size_t, size_t>{2, 1, 1};
+    case 0b1001: // VST2 A1 / VLD2 A1
+        if (size == 0b11 || align == 0b11) {
+            return std::nullopt;
+        }
+        return std::tuple<size_t, size_t, size_t>{2, 1, 2};
+    case 0b0011: // VST2 A2 / VLD2 A2
+        if (size == 0b11) {
+            return std::nullopt;
+        }
+        return std::tuple<size_t, size_t, size_t>{2, 2, 2};
+    case 0b0100: // VST3 / VLD3
+        if (size == 0b11 || Common::Bit<1>(align)) {
+            return std::nullopt;
+        }
+        return std::tuple<size_t, size_t, size_t>{3, 1, 1};
+    case 0b0101: // VST3 / VLD3
+        if (size == 0b11 || Common::Bit<1>(align)) {
+            return std::nullopt;
+        }
+        return std::tuple<size_t, size_t, size_t>{3, 1, 2};
+    case 0b0000: // VST4 / VLD4
+        if (size == 0b11) {
+            return std::nullopt;
+        }
+        return std::tuple<size_t, size_t, size_t>{4, 1, 1};
+    case 0b0001: // VST4 / VLD4
+        if (size == 0b11) {
+            return std::nullopt;
+        }
+        return std::tuple<size_t, size_t, size_t>{4, 1, 2};
+    }
+    return std::nullopt;
+}
+
+} // Anonymous namespace
+
+bool ArmTranslatorVisitor::asimd_VST_multiple(bool D, Reg n, size_t Vd, Imm<4> type, size_t size, size_t align, Reg m) {
+    const auto decoded_type = DecodeType(type, size, align);
+    if (!decoded_type) {
+        return UndefinedInstruction();
+    }
+    const auto [nelem, regs, inc] = *decoded_type;
+
+    const ExtReg d = ToVector(false, Vd, D);
+    const size_t d_last = RegNumber(d) + inc * (nelem - 1) + (regs - 1);
+    if (n == Reg::R15 || d_last > 31) {
+        return UnpredictableInstruction();
+    }
+
+    const size_t ebytes = static_cast<size_t>(1) << size;
+    const size_t elements = 8 / ebytes;
+
+    const bool wback = m != Reg::R15;
+    const bool register_index = m != Reg::R15 && m != Reg::R13;
+
+    // Registers are indexed relative to d; at most eight are accessed (VST4 with a stride of two).
+    std::array<IR::U128, 8> values;
+    for (size_t r = 0; r < regs; r++) {
+        for (size_t i = 0; i < nelem; i++) {
+            values[i * inc + r] = ir.GetVector(d + i * inc + r);
+        }
+    }
+
+    IR::U32 address = ir.GetRegister(n);
+    for (size_t r = 0; r < regs; r++) {
+        for (size_t e = 0; e < elements; e++) {
+            for (size_t i = 0; i < nelem; i++) {
+                const IR::UAny element = ir.VectorGetElement(8 * ebytes, values[i * inc + r], e);
+
+                switch (ebytes) {
+                case 1:
+                    ir.WriteMemory8(address, IR::U8{element});
+                    break;
+                case 2:
+                    ir.WriteMemory16(address, IR::U16{element});
+                    break;
+                case 4:
+                    ir.WriteMemory32(address, IR::U32{element});
+                    break;
+                case 8:
+                    ir.WriteMemory64(address, IR::U64{element});
+                    break;
+                default:
+                    UNREACHABLE();
+                }
+
+                address = ir.Add(address, ir.Imm32(static_cast<u32>(ebytes)));
+            }
+        }
+    }
+
+    if (wback) {
+        if (register_index) {
+            ir.SetRegister(n, ir.Add(ir.GetRegister(n), ir.GetRegister(m)));
+        } else {
+            ir.SetRegister(n, ir.Add(ir.GetRegister(n), ir.Imm32(static_cast<u32>(8 * nelem * regs))));
+        }
+    }
+
+    return true;
+}
+
+bool ArmTranslatorVisitor::asimd_VLD_multiple(bool D, Reg n, size_t Vd, Imm<4> type, size_t size, size_t align, Reg m) {
+    const auto decoded_type = DecodeType(type, size, align);
+    if (!decoded_type) {
+        return UndefinedInstruction();
+    }
+    const auto [nelem, regs, inc] = *decoded_type;
+
+    const ExtReg d = ToVector(false, Vd, D);
+    const size_t d_last = RegNumber(d) + inc * (nelem - 1) + (regs - 1);
+    if (n == Reg::R15 || d_last > 31) {
+        return UnpredictableInstruction();
+    }
+
+    const size_t ebytes = static_cast<size_t>(1) << size;
+    const size_t elements = 8 / ebytes;
+
+    const bool wback = m != Reg::R15;
+    const bool register_index = m != Reg::R15 && m != Reg::R13;
+
+    // Every loaded register is completely overwritten, so there is no need to read the old contents.
+    std::array<IR::U128, 8> values;
+    for (size_t r = 0; r < regs; r++) {
+        for (size_t i = 0; i < nelem; i++) {
+            values[i * inc + r] = ir.ZeroVector();
+        }
+    }
+
+    IR::U32 address = ir.GetRegister(n);
+    for (size_t r = 0; r < regs; r++) {
+        for (size_t e = 0; e < elements; e++) {
+            for (size_t i = 0; i < nelem; i++) {
+                IR::UAny element;
+                switch (ebytes) {
+                case 1:
+                    element = ir.ReadMemory8(address);
+                    break;
+                case 2:
+                    element = ir.ReadMemory16(address);
+                    break;
+                case 4:
+                    element = ir.ReadMemory32(address);
+                    break;
+                case 8:
+                    element = ir.ReadMemory64(address);
+                    break;
+                default:
+                    UNREACHABLE();
+                }
+
+                values[i * inc + r] = ir.VectorSetElement(8 * ebytes, values[i * inc + r], e, element);
+
+                address = ir.Add(address, ir.Imm32(static_cast<u32>(ebytes)));
+            }
+        }
+    }
+
+    for (size_t r = 0; r < regs; r++) {
+        for (size_t i = 0; i < nelem; i++) {
+            ir.SetVector(d + i * inc + r, values[i * inc + r]);
+        }
+    }
+
+    if (wback) {
+        if (register_index) {
+            ir.SetRegister(n, ir.Add(ir.GetRegister(n), ir.GetRegister(m)));
+        } else {
+            ir.SetRegister(n, ir.Add(ir.GetRegister(n), ir.Imm32(static_cast<u32>(8 * nelem * regs))));
+        }
+    }
+
+    return true;
+}
+
+} // namespace Dynarmic::A32
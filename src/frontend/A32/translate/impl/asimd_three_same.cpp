@@ -0,0 +1,238 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "common/bit_util.h"
+#include "frontend/A32/translate/impl/translate_arm.h"
+
+namespace Dynarmic::A32 {
+namespace {
+
+bool IsUndefinedQuadRegister(bool Q, size_t Vd, size_t Vn, size_t Vm) {
+    return Q && (Common::Bit<0>(Vd) || Common::Bit<0>(Vn) || Common::Bit<0>(Vm));
+}
+
+template <bool WithDst, typename Callable>
+bool BitwiseInstruction(ArmTranslatorVisitor& v, bool D, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm, Callable fn) {
+    if (IsUndefinedQuadRegister(Q, Vd, Vn, Vm)) {
+        return v.UndefinedInstruction();
+    }
+
+    const auto d = ToVector(Q, Vd, D);
+    const auto m = ToVector(Q, Vm, M);
+    const auto n = ToVector(Q, Vn, N);
+
+    const IR::U128 reg_n = v.ir.GetVector(n);
+    const IR::U128 reg_m = v.ir.GetVector(m);
+
+    if constexpr (WithDst) {
+        const IR::U128 reg_d = v.ir.GetVector(d);
+        v.ir.SetVector(d, fn(reg_d, reg_n, reg_m));
+    } else {
+        v.ir.SetVector(d, fn(reg_n, reg_m));
+    }
+
+    return true;
+}
+
+template <typename Callable>
+bool IntegerInstruction(ArmTranslatorVisitor& v, bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm, bool allow_64bit, Callable fn) {
+    if (sz == 0b11 && !allow_64bit) {
+        return v.UndefinedInstruction();
+    }
+
+    const size_t esize = 8U << sz;
+    return BitwiseInstruction<false>(v, D, Vn, Vd, N, Q, M, Vm, [&](const IR::U128& reg_n, const IR::U128& reg_m) {
+        return fn(esize, reg_n, reg_m);
+    });
+}
+
+template <typename Callable>
+bool FloatingPointInstruction(ArmTranslatorVisitor& v, bool D, bool sz, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm, Callable fn) {
+    if (sz) {
+        // Half-precision arithmetic is not available in ARMv7 Advanced SIMD.
+        return v.UndefinedInstruction();
+    }
+
+    // Advanced SIMD floating-point instructions ignore FPSCR and always operate under the
+    // "standard FPSCR value" (flush-to-zero, default NaN, round to nearest). Our floating-point
+    // IR uses the FPSCR of the current location, so we can only use it when the two agree.
+    const auto fpscr = v.ir.current_location.FPSCR();
+    if (!fpscr.FTZ() || !fpscr.DN() || fpscr.RMode() != FP::RoundingMode::ToNearest_TieEven) {
+        return v.InterpretThisInstruction();
+    }
+
+    return BitwiseInstruction<false>(v, D, Vn, Vd, N, Q, M, Vm, [&](const IR::U128& reg_n, const IR::U128& reg_m) {
+        return fn(reg_n, reg_m);
+    });
+}
+
+} // Anonymous namespace
+
+bool ArmTranslatorVisitor::asimd_VHADD(bool U, bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    return IntegerInstruction(*this, D, sz, Vn, Vd, N, Q, M, Vm, false, [this, U](size_t esize, const auto& reg_n, const auto& reg_m) {
+        return U ? ir.VectorHalvingAddUnsigned(esize, reg_n, reg_m) : ir.VectorHalvingAddSigned(esize, reg_n, reg_m);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VRHADD(bool U, bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    return IntegerInstruction(*this, D, sz, Vn, Vd, N, Q, M, Vm, false, [this, U](size_t esize, const auto& reg_n, const auto& reg_m) {
+        return U ? ir.VectorRoundingHalvingAddUnsigned(esize, reg_n, reg_m) : ir.VectorRoundingHalvingAddSigned(esize, reg_n, reg_m);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VAND_reg(bool D, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    return BitwiseInstruction<false>(*this, D, Vn, Vd, N, Q, M, Vm, [this](const auto& reg_n, const auto& reg_m) {
+        return ir.VectorAnd(reg_n, reg_m);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VBIC_reg(bool D, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    return BitwiseInstruction<false>(*this, D, Vn, Vd, N, Q, M, Vm, [this](const auto& reg_n, const auto& reg_m) {
+        return ir.VectorAnd(reg_n, ir.VectorNot(reg_m));
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VORR_reg(bool D, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    return BitwiseInstruction<false>(*this, D, Vn, Vd, N, Q, M, Vm, [this](const auto& reg_n, const auto& reg_m) {
+        return ir.VectorOr(reg_n, reg_m);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VORN_reg(bool D, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    return BitwiseInstruction<false>(*this, D, Vn, Vd, N, Q, M, Vm, [this](const auto& reg_n, const auto& reg_m) {
+        return ir.VectorOr(reg_n, ir.VectorNot(reg_m));
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VEOR_reg(bool D, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    return BitwiseInstruction<false>(*this, D, Vn, Vd, N, Q, M, Vm, [this](const auto& reg_n, const auto& reg_m) {
+        return ir.VectorEor(reg_n, reg_m);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VBSL(bool D, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    return BitwiseInstruction<true>(*this, D, Vn, Vd, N, Q, M, Vm, [this](const auto& reg_d, const auto& reg_n, const auto& reg_m) {
+        return ir.VectorOr(ir.VectorAnd(reg_n, reg_d), ir.VectorAnd(reg_m, ir.VectorNot(reg_d)));
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VBIT(bool D, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    return BitwiseInstruction<true>(*this, D, Vn, Vd, N, Q, M, Vm, [this](const auto& reg_d, const auto& reg_n, const auto& reg_m) {
+        return ir.VectorOr(ir.VectorAnd(reg_n, reg_m), ir.VectorAnd(reg_d, ir.VectorNot(reg_m)));
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VBIF(bool D, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    return BitwiseInstruction<true>(*this, D, Vn, Vd, N, Q, M, Vm, [this](const auto& reg_d, const auto& reg_n, const auto& reg_m) {
+        return ir.VectorOr(ir.VectorAnd(reg_d, reg_m), ir.VectorAnd(reg_n, ir.VectorNot(reg_m)));
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VHSUB(bool U, bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    return IntegerInstruction(*this, D, sz, Vn, Vd, N, Q, M, Vm, false, [this, U](size_t esize, const auto& reg_n, const auto& reg_m) {
+        return U ? ir.VectorHalvingSubUnsigned(esize, reg_n, reg_m) : ir.VectorHalvingSubSigned(esize, reg_n, reg_m);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VCGT_reg(bool U, bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    return IntegerInstruction(*this, D, sz, Vn, Vd, N, Q, M, Vm, false, [this, U](size_t esize, const auto& reg_n, const auto& reg_m) {
+        return U ? ir.VectorGreaterUnsigned(esize, reg_n, reg_m) : ir.VectorGreaterSigned(esize, reg_n, reg_m);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VCGE_reg(bool U, bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    return IntegerInstruction(*this, D, sz, Vn, Vd, N, Q, M, Vm, false, [this, U](size_t esize, const auto& reg_n, const auto& reg_m) {
+        return U ? ir.VectorGreaterEqualUnsigned(esize, reg_n, reg_m) : ir.VectorGreaterEqualSigned(esize, reg_n, reg_m);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VMAX(bool U, bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool Q, bool M, bool op, size_t Vm) {
+    return IntegerInstruction(*this, D, sz, Vn, Vd, N, Q, M, Vm, false, [this, U, op](size_t esize, const auto& reg_n, const auto& reg_m) {
+        if (op) {
+            return U ? ir.VectorMinUnsigned(esize, reg_n, reg_m) : ir.VectorMinSigned(esize, reg_n, reg_m);
+        }
+        return U ? ir.VectorMaxUnsigned(esize, reg_n, reg_m) : ir.VectorMaxSigned(esize, reg_n, reg_m);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VADD_int(bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    return IntegerInstruction(*this, D, sz, Vn, Vd, N, Q, M, Vm, true, [this](size_t esize, const auto& reg_n, const auto& reg_m) {
+        return ir.VectorAdd(esize, reg_n, reg_m);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VSUB_int(bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    return IntegerInstruction(*this, D, sz, Vn, Vd, N, Q, M, Vm, true, [this](size_t esize, const auto& reg_n, const auto& reg_m) {
+        return ir.VectorSub(esize, reg_n, reg_m);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VTST(bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    return IntegerInstruction(*this, D, sz, Vn, Vd, N, Q, M, Vm, false, [this](size_t esize, const auto& reg_n, const auto& reg_m) {
+        const auto anded = ir.VectorAnd(reg_n, reg_m);
+        return ir.VectorNot(ir.VectorEqual(esize, anded, ir.ZeroVector()));
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VCEQ_reg(bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    return IntegerInstruction(*this, D, sz, Vn, Vd, N, Q, M, Vm, false, [this](size_t esize, const auto& reg_n, const auto& reg_m) {
+        return ir.VectorEqual(esize, reg_n, reg_m);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VMLA(bool op, bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    if (sz == 0b11) {
+        return UndefinedInstruction();
+    }
+
+    const size_t esize = 8U << sz;
+    return BitwiseInstruction<true>(*this, D, Vn, Vd, N, Q, M, Vm, [this, op, esize](const auto& reg_d, const auto& reg_n, const auto& reg_m) {
+        const auto product = ir.VectorMultiply(esize, reg_n, reg_m);
+        return op ? ir.VectorSub(esize, reg_d, product) : ir.VectorAdd(esize, reg_d, product);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VMUL(bool P, bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    if (P && sz != 0b00) {
+        return UndefinedInstruction();
+    }
+
+    return IntegerInstruction(*this, D, sz, Vn, Vd, N, Q, M, Vm, false, [this, P](size_t esize, const auto& reg_n, const auto& reg_m) {
+        return P ? ir.VectorPolynomialMultiply(reg_n, reg_m) : ir.VectorMultiply(esize, reg_n, reg_m);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VADD_float(bool D, bool sz, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    return FloatingPointInstruction(*this, D, sz, Vn, Vd, N, Q, M, Vm, [this](const auto& reg_n, const auto& reg_m) {
+        return ir.FPVectorAdd(32, reg_n, reg_m);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VSUB_float(bool D, bool sz, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    return FloatingPointInstruction(*this, D, sz, Vn, Vd, N, Q, M, Vm, [this](const auto& reg_n, const auto& reg_m) {
+        return ir.FPVectorSub(32, reg_n, reg_m);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VMUL_float(bool D, bool sz, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    return FloatingPointInstruction(*this, D, sz, Vn, Vd, N, Q, M, Vm, [this](const auto& reg_n, const auto& reg_m) {
+        return ir.FPVectorMul(32, reg_n, reg_m);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VMAX_float(bool D, bool sz, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    return FloatingPointInstruction(*this, D, sz, Vn, Vd, N, Q, M, Vm, [this](const auto& reg_n, const auto& reg_m) {
+        return ir.FPVectorMax(32, reg_n, reg_m);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VMIN_float(bool D, bool sz, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    return FloatingPointInstruction(*this, D, sz, Vn, Vd, N, Q, M, Vm, [this](const auto& reg_n, const auto& reg_m) {
+        return ir.FPVectorMin(32, reg_n, reg_m);
+    });
+}
+
+} // namespace Dynarmic::A32
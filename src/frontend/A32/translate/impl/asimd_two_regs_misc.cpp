@@ -0,0 +1,107 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "common/bit_util.h"
+#include "frontend/A32/translate/impl/translate_arm.h"
+
+namespace Dynarmic::A32 {
+namespace {
+
+template <typename Callable>
+bool UnaryInstruction(ArmTranslatorVisitor& v, bool D, size_t Vd, bool Q, bool M, size_t Vm, Callable fn) {
+    if (Q && (Common::Bit<0>(Vd) || Common::Bit<0>(Vm))) {
+        return v.UndefinedInstruction();
+    }
+
+    const auto d = ToVector(Q, Vd, D);
+    const auto m = ToVector(Q, Vm, M);
+
+    const IR::U128 reg_m = v.ir.GetVector(m);
+    v.ir.SetVector(d, fn(reg_m));
+    return true;
+}
+
+} // Anonymous namespace
+
+bool ArmTranslatorVisitor::asimd_VSWP(bool D, size_t sz, size_t Vd, bool Q, bool M, size_t Vm) {
+    if (sz != 0b00) {
+        return UndefinedInstruction();
+    }
+
+    if (Q && (Common::Bit<0>(Vd) || Common::Bit<0>(Vm))) {
+        return UndefinedInstruction();
+    }
+
+    const auto d = ToVector(Q, Vd, D);
+    const auto m = ToVector(Q, Vm, M);
+
+    // Swapping a register with itself is a no-op.
+    if (d == m) {
+        return true;
+    }
+
+    const IR::U128 reg_d = ir.GetVector(d);
+    const IR::U128 reg_m = ir.GetVector(m);
+
+    ir.SetVector(m, reg_d);
+    ir.SetVector(d, reg_m);
+    return true;
+}
+
+bool ArmTranslatorVisitor::asimd_VCLZ(bool D, size_t sz, size_t Vd, bool Q, bool M, size_t Vm) {
+    if (sz == 0b11) {
+        return UndefinedInstruction();
+    }
+
+    const size_t esize = 8U << sz;
+    return UnaryInstruction(*this, D, Vd, Q, M, Vm, [this, esize](const auto& reg_m) {
+        return ir.VectorCountLeadingZeros(esize, reg_m);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VCNT(bool D, size_t sz, size_t Vd, bool Q, bool M, size_t Vm) {
+    if (sz != 0b00) {
+        return UndefinedInstruction();
+    }
+
+    return UnaryInstruction(*this, D, Vd, Q, M, Vm, [this](const auto& reg_m) {
+        return ir.VectorPopulationCount(reg_m);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VMVN_reg(bool D, size_t sz, size_t Vd, bool Q, bool M, size_t Vm) {
+    if (sz != 0b00) {
+        return UndefinedInstruction();
+    }
+
+    return UnaryInstruction(*this, D, Vd, Q, M, Vm, [this](const auto& reg_m) {
+        return ir.VectorNot(reg_m);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VABS(bool D, size_t sz, size_t Vd, bool Q, bool M, size_t Vm) {
+    if (sz == 0b11) {
+        return UndefinedInstruction();
+    }
+
+    const size_t esize = 8U << sz;
+    return UnaryInstruction(*this, D, Vd, Q, M, Vm, [this, esize](const auto& reg_m) {
+        return ir.VectorAbs(esize, reg_m);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VNEG(bool D, size_t sz, size_t Vd, bool Q, bool M, size_t Vm) {
+    if (sz == 0b11) {
+        return UndefinedInstruction();
+    }
+
+    const size_t esize = 8U << sz;
+    return UnaryInstruction(*this, D, Vd, Q, M, Vm, [this, esize](const auto& reg_m) {
+        return ir.VectorSub(esize, ir.ZeroVector(), reg_m);
+    });
+}
+
+} // namespace Dynarmic::A32
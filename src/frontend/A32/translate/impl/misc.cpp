@@ -45,13 +45,9 @@ bool ArmTranslatorVisitor::arm_BFI(Cond cond, Imm<5> msb, Reg d, Imm<5> lsb, Reg
         return true;
     }
 
-    const u32 lsb_value = lsb.ZeroExtend();
-    const u32 msb_value = msb.ZeroExtend();
-    const u32 inclusion_mask = Common::Ones<u32>(msb_value - lsb_value + 1) << lsb_value;
-    const u32 exclusion_mask = ~inclusion_mask;
-    const IR::U32 operand1 = ir.And(ir.GetRegister(d), ir.Imm32(exclusion_mask));
-    const IR::U32 operand2 = ir.And(ir.LogicalShiftLeft(ir.GetRegister(n), ir.Imm8(u8(lsb_value))), ir.Imm32(inclusion_mask));
-    const IR::U32 result = ir.Or(operand1, operand2);
+    const u8 lsb_value = lsb.ZeroExtend<u8>();
+    const u8 msb_value = msb.ZeroExtend<u8>();
+    const IR::U32 result = ir.BitFieldInsert(ir.GetRegister(d), ir.GetRegister(n), ir.Imm8(lsb_value), ir.Imm8(msb_value - lsb_value + 1));
 
     ir.SetRegister(d, result);
     return true;
@@ -121,13 +117,8 @@ bool ArmTranslatorVisitor::arm_SBFX(Cond cond, Imm<5> widthm1, Reg d, Imm<5> lsb
         return true;
     }
 
-    constexpr size_t max_width = Common::BitSize<u32>();
-    const u32 width = widthm1_value + 1;
-    const u8 left_shift_amount = static_cast<u8>(max_width - width - lsb_value);
-    const u8 right_shift_amount = static_cast<u8>(max_width - width);
     const IR::U32 operand = ir.GetRegister(n);
-    const IR::U32 tmp = ir.LogicalShiftLeft(operand, ir.Imm8(left_shift_amount));
-    const IR::U32 result = ir.ArithmeticShiftRight(tmp, ir.Imm8(right_shift_amount));
+    const IR::U32 result = ir.SignedBitFieldExtract(operand, ir.Imm8(u8(lsb_value)), ir.Imm8(u8(widthm1_value + 1)));
 
     ir.SetRegister(d, result);
     return true;
@@ -169,8 +160,7 @@ bool ArmTranslatorVisitor::arm_UBFX(Cond cond, Imm<5> widthm1, Reg d, Imm<5> lsb
     }
 
     const IR::U32 operand = ir.GetRegister(n);
-    const IR::U32 mask = ir.Imm32(Common::Ones<u32>(widthm1_value + 1));
-    const IR::U32 result = ir.And(ir.LogicalShiftRight(operand, ir.Imm8(u8(lsb_value))), mask);
+    const IR::U32 result = ir.UnsignedBitFieldExtract(operand, ir.Imm8(u8(lsb_value)), ir.Imm8(u8(widthm1_value + 1)));
 
     ir.SetRegister(d, result);
     return true;
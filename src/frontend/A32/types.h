@@ -37,6 +37,8 @@ enum class ExtReg {
     D8, D9, D10, D11, D12, D13, D14, D15,
     D16, D17, D18, D19, D20, D21, D22, D23,
     D24, D25, D26, D27, D28, D29, D30, D31,
+    Q0, Q1, Q2, Q3, Q4, Q5, Q6, Q7,
+    Q8, Q9, Q10, Q11, Q12, Q13, Q14, Q15,
 };
 
 using RegList = u16;
@@ -74,6 +76,10 @@ constexpr bool IsDoubleExtReg(ExtReg reg) {
     return reg >= ExtReg::D0 && reg <= ExtReg::D31;
 }
 
+constexpr bool IsQuadExtReg(ExtReg reg) {
+    return reg >= ExtReg::Q0 && reg <= ExtReg::Q15;
+}
+
 inline size_t RegNumber(Reg reg) {
     ASSERT(reg != Reg::INVALID_REG);
     return static_cast<size_t>(reg);
@@ -88,6 +94,10 @@ inline size_t RegNumber(ExtReg reg) {
         return static_cast<size_t>(reg) - static_cast<size_t>(ExtReg::D0);
     }
 
+    if (IsQuadExtReg(reg)) {
+        return static_cast<size_t>(reg) - static_cast<size_t>(ExtReg::Q0);
+    }
+
     ASSERT_MSG(false, "Invalid extended register");
 }
 
@@ -102,7 +112,8 @@ inline ExtReg operator+(ExtReg reg, size_t number) {
     const auto new_reg = static_cast<ExtReg>(static_cast<size_t>(reg) + number);
 
     ASSERT((IsSingleExtReg(reg) && IsSingleExtReg(new_reg)) ||
-           (IsDoubleExtReg(reg) && IsDoubleExtReg(new_reg)));
+           (IsDoubleExtReg(reg) && IsDoubleExtReg(new_reg)) ||
+           (IsQuadExtReg(reg) && IsQuadExtReg(new_reg)));
 
     return new_reg;
 }
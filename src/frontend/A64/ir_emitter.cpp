@@ -107,43 +107,43 @@ void IREmitter::SetExclusive(const IR::U64& vaddr, size_t byte_size) {
 }
 
 IR::U8 IREmitter::ReadMemory8(const IR::U64& vaddr) {
-    return Inst<IR::U8>(Opcode::A64ReadMemory8, vaddr);
+    return Inst<IR::U8>(Opcode::A64ReadMemory8, vaddr, Imm64(0), Imm8(0));
 }
 
 IR::U16 IREmitter::ReadMemory16(const IR::U64& vaddr) {
-    return Inst<IR::U16>(Opcode::A64ReadMemory16, vaddr);
+    return Inst<IR::U16>(Opcode::A64ReadMemory16, vaddr, Imm64(0), Imm8(0));
 }
 
 IR::U32 IREmitter::ReadMemory32(const IR::U64& vaddr) {
-    return Inst<IR::U32>(Opcode::A64ReadMemory32, vaddr);
+    return Inst<IR::U32>(Opcode::A64ReadMemory32, vaddr, Imm64(0), Imm8(0));
 }
 
 IR::U64 IREmitter::ReadMemory64(const IR::U64& vaddr) {
-    return Inst<IR::U64>(Opcode::A64ReadMemory64, vaddr);
+    return Inst<IR::U64>(Opcode::A64ReadMemory64, vaddr, Imm64(0), Imm8(0));
 }
 
 IR::U128 IREmitter::ReadMemory128(const IR::U64& vaddr) {
-    return Inst<IR::U128>(Opcode::A64ReadMemory128, vaddr);
+    return Inst<IR::U128>(Opcode::A64ReadMemory128, vaddr, Imm64(0), Imm8(0));
 }
 
 void IREmitter::WriteMemory8(const IR::U64& vaddr, const IR::U8& value) {
-    Inst(Opcode::A64WriteMemory8, vaddr, value);
+    Inst(Opcode::A64WriteMemory8, vaddr, Imm64(0), Imm8(0), value);
 }
 
 void IREmitter::WriteMemory16(const IR::U64& vaddr, const IR::U16& value) {
-    Inst(Opcode::A64WriteMemory16, vaddr, value);
+    Inst(Opcode::A64WriteMemory16, vaddr, Imm64(0), Imm8(0), value);
 }
 
 void IREmitter::WriteMemory32(const IR::U64& vaddr, const IR::U32& value) {
-    Inst(Opcode::A64WriteMemory32, vaddr, value);
+    Inst(Opcode::A64WriteMemory32, vaddr, Imm64(0), Imm8(0), value);
 }
 
 void IREmitter::WriteMemory64(const IR::U64& vaddr, const IR::U64& value) {
-    Inst(Opcode::A64WriteMemory64, vaddr, value);
+    Inst(Opcode::A64WriteMemory64, vaddr, Imm64(0), Imm8(0), value);
 }
 
 void IREmitter::WriteMemory128(const IR::U64& vaddr, const IR::U128& value) {
-    Inst(Opcode::A64WriteMemory128, vaddr, value);
+    Inst(Opcode::A64WriteMemory128, vaddr, Imm64(0), Imm8(0), value);
 }
 
 IR::U32 IREmitter::ExclusiveWriteMemory8(const IR::U64& vaddr, const IR::U8& value) {
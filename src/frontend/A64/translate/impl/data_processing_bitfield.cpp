@@ -4,16 +4,11 @@
  * General Public License version 2 or any later version.
  */
 
+#include "common/bit_util.h"
 #include "frontend/A64/translate/impl/impl.h"
 
 namespace Dynarmic::A64 {
 
-static IR::U32U64 ReplicateBit(IREmitter& ir, const IR::U32U64& value, u8 bit_position_to_replicate) {
-    const u8 datasize = value.GetType() == IR::Type::U64 ? 64 : 32;
-    const auto bit = ir.LogicalShiftLeft(value, ir.Imm8(datasize - 1 - bit_position_to_replicate));
-    return ir.ArithmeticShiftRight(bit, ir.Imm8(datasize - 1));
-}
-
 bool TranslatorVisitor::SBFM(bool sf, bool N, Imm<6> immr, Imm<6> imms, Reg Rn, Reg Rd) {
     if (sf && !N) {
         return ReservedValue();
@@ -25,21 +20,22 @@ bool TranslatorVisitor::SBFM(bool sf, bool N, Imm<6> immr, Imm<6> imms, Reg Rn,
 
     const u8 R = immr.ZeroExtend<u8>();
     const u8 S = imms.ZeroExtend<u8>();
-    const auto masks = DecodeBitMasks(N, imms, immr, false);
-    if (!masks) {
-        return ReservedValue();
-    }
-
     const size_t datasize = sf ? 64 : 32;
-    const auto src = X(datasize, Rn);
-
-    auto bot = ir.And(ir.RotateRight(src, ir.Imm8(R)), I(datasize, masks->wmask));
-    auto top = ReplicateBit(ir, src, S);
-
-    top = ir.And(top, I(datasize, ~masks->tmask));
-    bot = ir.And(bot, I(datasize, masks->tmask));
+    const IR::U32U64 src = X(datasize, Rn);
+
+    if (S >= R) {
+        // ASR, SXTB, SXTH, SXTW, SBFX: extract bits [R, S] and sign-extend them.
+        if (S == datasize - 1) {
+            X(datasize, Rd, ir.ArithmeticShiftRight(src, ir.Imm8(R)));
+        } else {
+            X(datasize, Rd, ir.SignedBitFieldExtract(src, ir.Imm8(R), ir.Imm8(S - R + 1)));
+        }
+        return true;
+    }
 
-    X(datasize, Rd, ir.Or(top, bot));
+    // SBFIZ: sign-extend bits [0, S] and place them at bit datasize - R.
+    const IR::U32U64 field = ir.SignedBitFieldExtract(src, ir.Imm8(0), ir.Imm8(S + 1));
+    X(datasize, Rd, ir.LogicalShiftLeft(field, ir.Imm8(static_cast<u8>(datasize - R))));
     return true;
 }
 
@@ -53,18 +49,20 @@ bool TranslatorVisitor::BFM(bool sf, bool N, Imm<6> immr, Imm<6> imms, Reg Rn, R
     }
 
     const u8 R = immr.ZeroExtend<u8>();
-    const auto masks = DecodeBitMasks(N, imms, immr, false);
-    if (!masks) {
-        return ReservedValue();
-    }
-
+    const u8 S = imms.ZeroExtend<u8>();
     const size_t datasize = sf ? 64 : 32;
-    const auto dst = X(datasize, Rd);
-    const auto src = X(datasize, Rn);
-
-    const auto bot = ir.Or(ir.And(dst, I(datasize, ~masks->wmask)), ir.And(ir.RotateRight(src, ir.Imm8(R)), I(datasize, masks->wmask)));
+    const IR::U32U64 dst = X(datasize, Rd);
+    const IR::U32U64 src = X(datasize, Rn);
+
+    if (S >= R) {
+        // BFXIL: replace bits [0, S - R] of the destination with bits [R, S] of the source.
+        const IR::U32U64 field = R == 0 ? src : ir.LogicalShiftRight(src, ir.Imm8(R));
+        X(datasize, Rd, ir.BitFieldInsert(dst, field, ir.Imm8(0), ir.Imm8(S - R + 1)));
+        return true;
+    }
 
-    X(datasize, Rd, ir.Or(ir.And(dst, I(datasize, ~masks->tmask)), ir.And(bot, I(datasize, masks->tmask))));
+    // BFI: replace bits [datasize - R, datasize - R + S] of the destination with bits [0, S] of the source.
+    X(datasize, Rd, ir.BitFieldInsert(dst, src, ir.Imm8(static_cast<u8>(datasize - R)), ir.Imm8(S + 1)));
     return true;
 }
 
@@ -78,16 +76,26 @@ bool TranslatorVisitor::UBFM(bool sf, bool N, Imm<6> immr, Imm<6> imms, Reg Rn,
     }
 
     const u8 R = immr.ZeroExtend<u8>();
-    const auto masks = DecodeBitMasks(N, imms, immr, false);
-    if (!masks) {
-        return ReservedValue();
-    }
-
+    const u8 S = imms.ZeroExtend<u8>();
     const size_t datasize = sf ? 64 : 32;
-    const auto src = X(datasize, Rn);
-    const auto bot = ir.And(ir.RotateRight(src, ir.Imm8(R)), I(datasize, masks->wmask));
+    const IR::U32U64 src = X(datasize, Rn);
+
+    if (S >= R) {
+        // LSR, UXTB, UXTH, UBFX: extract bits [R, S] and zero-extend them.
+        if (S == datasize - 1) {
+            X(datasize, Rd, ir.LogicalShiftRight(src, ir.Imm8(R)));
+        } else if (R == 0) {
+            X(datasize, Rd, ir.And(src, I(datasize, Common::Ones<u64>(S + 1))));
+        } else {
+            X(datasize, Rd, ir.UnsignedBitFieldExtract(src, ir.Imm8(R), ir.Imm8(S - R + 1)));
+        }
+        return true;
+    }
 
-    X(datasize, Rd, ir.And(bot, I(datasize, masks->tmask)));
+    // LSL, UBFIZ: place bits [0, S] at bit datasize - R.
+    const u8 shift = static_cast<u8>(datasize - R);
+    const IR::U32U64 field = S + 1 + shift >= static_cast<int>(datasize) ? src : ir.And(src, I(datasize, Common::Ones<u64>(S + 1)));
+    X(datasize, Rd, ir.LogicalShiftLeft(field, ir.Imm8(shift)));
     return true;
 }
 
@@ -4,12 +4,63 @@
  * General Public License version 2 or any later version.
  */
 
+#include <array>
 #include <optional>
 
 #include "frontend/A64/translate/impl/impl.h"
 
 namespace Dynarmic::A64 {
 
+/// Splits selem consecutive 128-bit chunks of interleaved structures into one register per structure member.
+static std::array<IR::U128, 4> DeinterleaveStructures(IREmitter& ir, size_t esize, size_t selem, const std::array<IR::U128, 4>& chunk) {
+    switch (selem) {
+    case 2:
+        return {ir.VectorDeinterleaveEven(esize, chunk[0], chunk[1]),
+                ir.VectorDeinterleaveOdd(esize, chunk[0], chunk[1])};
+    case 3:
+        return {ir.VectorDeinterleaveTriple(esize, chunk[0], chunk[1], chunk[2], 0),
+                ir.VectorDeinterleaveTriple(esize, chunk[0], chunk[1], chunk[2], 1),
+                ir.VectorDeinterleaveTriple(esize, chunk[0], chunk[1], chunk[2], 2)};
+    case 4: {
+        const IR::U128 even_lo = ir.VectorDeinterleaveEven(esize, chunk[0], chunk[1]);
+        const IR::U128 odd_lo = ir.VectorDeinterleaveOdd(esize, chunk[0], chunk[1]);
+        const IR::U128 even_hi = ir.VectorDeinterleaveEven(esize, chunk[2], chunk[3]);
+        const IR::U128 odd_hi = ir.VectorDeinterleaveOdd(esize, chunk[2], chunk[3]);
+        return {ir.VectorDeinterleaveEven(esize, even_lo, even_hi),
+                ir.VectorDeinterleaveEven(esize, odd_lo, odd_hi),
+                ir.VectorDeinterleaveOdd(esize, even_lo, even_hi),
+                ir.VectorDeinterleaveOdd(esize, odd_lo, odd_hi)};
+    }
+    }
+    UNREACHABLE();
+    return {};
+}
+
+/// Inverse of DeinterleaveStructures: packs selem registers into consecutive 128-bit chunks of interleaved structures.
+static std::array<IR::U128, 4> InterleaveStructures(IREmitter& ir, size_t esize, size_t selem, const std::array<IR::U128, 4>& values) {
+    switch (selem) {
+    case 2:
+        return {ir.VectorInterleaveLower(esize, values[0], values[1]),
+                ir.VectorInterleaveUpper(esize, values[0], values[1])};
+    case 3:
+        return {ir.VectorInterleaveTriple(esize, values[0], values[1], values[2], 0),
+                ir.VectorInterleaveTriple(esize, values[0], values[1], values[2], 1),
+                ir.VectorInterleaveTriple(esize, values[0], values[1], values[2], 2)};
+    case 4: {
+        const IR::U128 lo_02 = ir.VectorInterleaveLower(esize, values[0], values[2]);
+        const IR::U128 lo_13 = ir.VectorInterleaveLower(esize, values[1], values[3]);
+        const IR::U128 hi_02 = ir.VectorInterleaveUpper(esize, values[0], values[2]);
+        const IR::U128 hi_13 = ir.VectorInterleaveUpper(esize, values[1], values[3]);
+        return {ir.VectorInterleaveLower(esize, lo_02, lo_13),
+                ir.VectorInterleaveUpper(esize, lo_02, lo_13),
+                ir.VectorInterleaveLower(esize, hi_02, hi_13),
+                ir.VectorInterleaveUpper(esize, hi_02, hi_13)};
+    }
+    }
+    UNREACHABLE();
+    return {};
+}
+
 static bool SharedDecodeAndOperation(TranslatorVisitor& v, bool wback, IR::MemOp memop, bool Q, std::optional<Reg> Rm, Imm<4> opcode, Imm<2> size, Reg Rn, Vec Vt) {
     const size_t datasize = Q ? 128 : 64;
     const size_t esize = 8 << size.ZeroExtend<size_t>();
@@ -77,20 +128,49 @@ static bool SharedDecodeAndOperation(TranslatorVisitor& v, bool wback, IR::MemOp
             offs = v.ir.Add(offs, v.ir.Imm64(ebytes * elements));
         }
     } else {
-        for (size_t e = 0; e < elements; e++) {
+        // The structures occupy a contiguous block of selem * datasize bits. It is transferred in 128-bit chunks
+        // and (de)interleaved within registers instead of one element at a time.
+        const size_t total_bytes = selem * datasize / 8;
+        const size_t chunks = (total_bytes + 15) / 16;
+
+        if (memop == IR::MemOp::LOAD) {
+            std::array<IR::U128, 4> chunk;
+            for (size_t i = 0; i < chunks; i++) {
+                const IR::U64 chunk_address = v.ir.Add(address, v.ir.Imm64(i * 16));
+                if (total_bytes - i * 16 >= 16) {
+                    chunk[i] = IR::U128{v.Mem(chunk_address, 16, IR::AccType::VEC)};
+                } else {
+                    chunk[i] = v.ir.ZeroExtendToQuad(IR::U64{v.Mem(chunk_address, 8, IR::AccType::VEC)});
+                }
+            }
+            // Only the lower half of each result survives a 64-bit write, so the remaining chunks are don't-cares.
+            for (size_t i = chunks; i < selem; i++) {
+                chunk[i] = chunk[i % chunks];
+            }
+
+            const auto values = DeinterleaveStructures(v.ir, esize, selem, chunk);
             for (size_t s = 0; s < selem; s++) {
                 const Vec tt = static_cast<Vec>((VecNumber(Vt) + s) % 32);
-                if (memop == IR::MemOp::LOAD) {
-                    const IR::UAny elem = v.Mem(v.ir.Add(address, offs), ebytes, IR::AccType::VEC);
-                    const IR::U128 vec = v.ir.VectorSetElement(esize, v.V(datasize, tt), e, elem);
-                    v.V(datasize, tt, vec);
+                v.V(datasize, tt, values[s]);
+            }
+        } else {
+            std::array<IR::U128, 4> values;
+            for (size_t s = 0; s < selem; s++) {
+                const Vec tt = static_cast<Vec>((VecNumber(Vt) + s) % 32);
+                values[s] = v.V(datasize, tt);
+            }
+
+            const auto chunk = InterleaveStructures(v.ir, esize, selem, values);
+            for (size_t i = 0; i < chunks; i++) {
+                const IR::U64 chunk_address = v.ir.Add(address, v.ir.Imm64(i * 16));
+                if (total_bytes - i * 16 >= 16) {
+                    v.Mem(chunk_address, 16, IR::AccType::VEC, chunk[i]);
                 } else {
-                    const IR::UAny elem = v.ir.VectorGetElement(esize, v.V(datasize, tt), e);
-                    v.Mem(v.ir.Add(address, offs), ebytes, IR::AccType::VEC, elem);
+                    v.Mem(chunk_address, 8, IR::AccType::VEC, v.ir.VectorGetElement(64, chunk[i], 0));
                 }
-                offs = v.ir.Add(offs, v.ir.Imm64(ebytes));
             }
         }
+        offs = v.ir.Imm64(total_bytes);
     }
 
     if (wback) {
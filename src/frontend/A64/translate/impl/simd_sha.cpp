@@ -111,18 +111,33 @@ IR::U128 SHA256hash(IREmitter& ir, IR::U128 x, IR::U128 y, IR::U128 w, SHA256Has
 } // Anonymous namespace
 
 bool TranslatorVisitor::SHA1C(Vec Vm, Vec Vn, Vec Vd) {
+    if (options.emit_sha_instructions) {
+        ir.SetQ(Vd, ir.SHA1HashUpdateChoose(ir.GetQ(Vd), ir.GetS(Vn), ir.GetQ(Vm)));
+        return true;
+    }
+
     const IR::U128 result = SHA1HashUpdate(ir, Vm, Vn, Vd, SHAchoose);
     ir.SetQ(Vd, result);
     return true;
 }
 
 bool TranslatorVisitor::SHA1M(Vec Vm, Vec Vn, Vec Vd) {
+    if (options.emit_sha_instructions) {
+        ir.SetQ(Vd, ir.SHA1HashUpdateMajority(ir.GetQ(Vd), ir.GetS(Vn), ir.GetQ(Vm)));
+        return true;
+    }
+
     const IR::U128 result = SHA1HashUpdate(ir, Vm, Vn, Vd, SHAmajority);
     ir.SetQ(Vd, result);
     return true;
 }
 
 bool TranslatorVisitor::SHA1P(Vec Vm, Vec Vn, Vec Vd) {
+    if (options.emit_sha_instructions) {
+        ir.SetQ(Vd, ir.SHA1HashUpdateParity(ir.GetQ(Vd), ir.GetS(Vn), ir.GetQ(Vm)));
+        return true;
+    }
+
     const IR::U128 result = SHA1HashUpdate(ir, Vm, Vn, Vd, SHAparity);
     ir.SetQ(Vd, result);
     return true;
@@ -176,6 +191,11 @@ bool TranslatorVisitor::SHA1H(Vec Vn, Vec Vd) {
 }
 
 bool TranslatorVisitor::SHA256SU0(Vec Vn, Vec Vd) {
+    if (options.emit_sha_instructions) {
+        ir.SetQ(Vd, ir.SHA256MessageSchedule0(ir.GetQ(Vd), ir.GetQ(Vn)));
+        return true;
+    }
+
     const IR::U128 d = ir.GetQ(Vd);
     const IR::U128 n = ir.GetQ(Vn);
 
@@ -206,6 +226,11 @@ bool TranslatorVisitor::SHA256SU0(Vec Vn, Vec Vd) {
 }
 
 bool TranslatorVisitor::SHA256SU1(Vec Vm, Vec Vn, Vec Vd) {
+    if (options.emit_sha_instructions) {
+        ir.SetQ(Vd, ir.SHA256MessageSchedule1(ir.GetQ(Vd), ir.GetQ(Vn), ir.GetQ(Vm)));
+        return true;
+    }
+
     const IR::U128 d = ir.GetQ(Vd);
     const IR::U128 m = ir.GetQ(Vm);
     const IR::U128 n = ir.GetQ(Vn);
@@ -248,12 +273,22 @@ bool TranslatorVisitor::SHA256SU1(Vec Vm, Vec Vn, Vec Vd) {
 }
 
 bool TranslatorVisitor::SHA256H(Vec Vm, Vec Vn, Vec Vd) {
+    if (options.emit_sha_instructions) {
+        ir.SetQ(Vd, ir.SHA256Hash(ir.GetQ(Vd), ir.GetQ(Vn), ir.GetQ(Vm), true));
+        return true;
+    }
+
     const IR::U128 result = SHA256hash(ir, ir.GetQ(Vd), ir.GetQ(Vn), ir.GetQ(Vm), SHA256HashPart::Part1);
     ir.SetQ(Vd, result);
     return true;
 }
 
 bool TranslatorVisitor::SHA256H2(Vec Vm, Vec Vn, Vec Vd) {
+    if (options.emit_sha_instructions) {
+        ir.SetQ(Vd, ir.SHA256Hash(ir.GetQ(Vn), ir.GetQ(Vd), ir.GetQ(Vm), false));
+        return true;
+    }
+
     const IR::U128 result = SHA256hash(ir, ir.GetQ(Vn), ir.GetQ(Vd), ir.GetQ(Vm), SHA256HashPart::Part2);
     ir.SetQ(Vd, result);
     return true;
@@ -132,12 +132,11 @@ enum class ComparisonType {
     AbsoluteGT
 };
 
-bool FPCompareRegister(TranslatorVisitor& v, bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd, ComparisonType type) {
-    if (sz && !Q) {
+bool FPCompareRegister(TranslatorVisitor& v, bool Q, size_t esize, Vec Vm, Vec Vn, Vec Vd, ComparisonType type) {
+    if (esize == 64 && !Q) {
         return v.ReservedValue();
     }
 
-    const size_t esize = sz ? 64 : 32;
     const size_t datasize = Q ? 128 : 64;
 
     const IR::U128 operand1 = v.V(datasize, Vn);
@@ -653,6 +652,18 @@ bool TranslatorVisitor::ADDP_vec(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FABD_3(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+    const size_t esize = 16;
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = V(datasize, Vm);
+    const IR::U128 result = ir.FPVectorAbs(esize, ir.FPVectorSub(esize, operand1, operand2));
+
+    V(datasize, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::FABD_4(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     if (sz && !Q) {
         return ReservedValue();
@@ -669,12 +680,32 @@ bool TranslatorVisitor::FABD_4(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FACGE_3(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPCompareRegister(*this, Q, 16, Vm, Vn, Vd, ComparisonType::AbsoluteGE);
+}
+
 bool TranslatorVisitor::FACGE_4(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
-    return FPCompareRegister(*this, Q, sz, Vm, Vn, Vd, ComparisonType::AbsoluteGE);
+    return FPCompareRegister(*this, Q, sz ? 64 : 32, Vm, Vn, Vd, ComparisonType::AbsoluteGE);
+}
+
+bool TranslatorVisitor::FACGT_3(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPCompareRegister(*this, Q, 16, Vm, Vn, Vd, ComparisonType::AbsoluteGT);
 }
 
 bool TranslatorVisitor::FACGT_4(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
-    return FPCompareRegister(*this, Q, sz, Vm, Vn, Vd, ComparisonType::AbsoluteGT);
+    return FPCompareRegister(*this, Q, sz ? 64 : 32, Vm, Vn, Vd, ComparisonType::AbsoluteGT);
+}
+
+bool TranslatorVisitor::FADD_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+    const size_t esize = 16;
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = V(datasize, Vm);
+    const IR::U128 result = ir.FPVectorAdd(esize, operand1, operand2);
+
+    V(datasize, Vd, result);
+    return true;
 }
 
 bool TranslatorVisitor::FADD_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
@@ -754,26 +785,27 @@ bool TranslatorVisitor::FMLS_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
 }
 
 bool TranslatorVisitor::FCMEQ_reg_3(bool Q, Vec Vm, Vec Vn, Vec Vd) {
-    const size_t datasize = Q ? 128 : 64;
-
-    const IR::U128 lhs = V(datasize, Vn);
-    const IR::U128 rhs = V(datasize, Vm);
-    const IR::U128 result = ir.FPVectorEqual(16, lhs, rhs);
-
-    V(datasize, Vd, result);
-    return true;
+    return FPCompareRegister(*this, Q, 16, Vm, Vn, Vd, ComparisonType::EQ);
 }
 
 bool TranslatorVisitor::FCMEQ_reg_4(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
-    return FPCompareRegister(*this, Q, sz, Vm, Vn, Vd, ComparisonType::EQ);
+    return FPCompareRegister(*this, Q, sz ? 64 : 32, Vm, Vn, Vd, ComparisonType::EQ);
+}
+
+bool TranslatorVisitor::FCMGE_reg_3(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPCompareRegister(*this, Q, 16, Vm, Vn, Vd, ComparisonType::GE);
 }
 
 bool TranslatorVisitor::FCMGE_reg_4(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
-    return FPCompareRegister(*this, Q, sz, Vm, Vn, Vd, ComparisonType::GE);
+    return FPCompareRegister(*this, Q, sz ? 64 : 32, Vm, Vn, Vd, ComparisonType::GE);
+}
+
+bool TranslatorVisitor::FCMGT_reg_3(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPCompareRegister(*this, Q, 16, Vm, Vn, Vd, ComparisonType::GT);
 }
 
 bool TranslatorVisitor::FCMGT_reg_4(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
-    return FPCompareRegister(*this, Q, sz, Vm, Vn, Vd, ComparisonType::GT);
+    return FPCompareRegister(*this, Q, sz ? 64 : 32, Vm, Vn, Vd, ComparisonType::GT);
 }
 
 bool TranslatorVisitor::AND_asimd(bool Q, Vec Vm, Vec Vn, Vec Vd) {
@@ -953,6 +985,18 @@ bool TranslatorVisitor::UMINP(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
     return PairedMinMaxOperation(*this, Q, size, Vm, Vn, Vd, MinMaxOperation::Min, Signedness::Unsigned);
 }
 
+bool TranslatorVisitor::FSUB_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+    const size_t esize = 16;
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = V(datasize, Vm);
+    const IR::U128 result = ir.FPVectorSub(esize, operand1, operand2);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::FSUB_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     if (sz && !Q) {
         return ReservedValue();
@@ -1178,6 +1222,18 @@ bool TranslatorVisitor::FADDP_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FMUL_vec_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+    const size_t esize = 16;
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = V(datasize, Vm);
+    const IR::U128 result = ir.FPVectorMul(esize, operand1, operand2);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::FMUL_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     if (sz && !Q) {
         return ReservedValue();
@@ -1194,6 +1250,18 @@ bool TranslatorVisitor::FMUL_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FMULX_vec_3(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+    const size_t esize = 16;
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = V(datasize, Vm);
+    const IR::U128 result = ir.FPVectorMulX(esize, operand1, operand2);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::FMULX_vec_4(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     if (sz && !Q) {
         return ReservedValue();
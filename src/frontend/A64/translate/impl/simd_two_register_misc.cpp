@@ -51,12 +51,11 @@ bool CompareAgainstZero(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vn, Vec V
     return true;
 }
 
-bool FPCompareAgainstZero(TranslatorVisitor& v, bool Q, bool sz, Vec Vn, Vec Vd, ComparisonType type) {
-    if (sz && !Q) {
+bool FPCompareAgainstZero(TranslatorVisitor& v, bool Q, size_t esize, Vec Vn, Vec Vd, ComparisonType type) {
+    if (esize == 64 && !Q) {
         return v.ReservedValue();
     }
 
-    const size_t esize = sz ? 64 : 32;
     const size_t datasize = Q ? 128 : 64;
 
     const IR::U128 operand = v.V(datasize, Vn);
@@ -333,34 +332,43 @@ bool TranslatorVisitor::FABS_2(bool Q, bool sz, Vec Vn, Vec Vd) {
 }
 
 bool TranslatorVisitor::FCMEQ_zero_3(bool Q, Vec Vn, Vec Vd) {
-    const size_t datasize = Q ? 128 : 64;
-
-    const IR::U128 operand = V(datasize, Vn);
-    const IR::U128 zero = ir.ZeroVector();
-    const IR::U128 result = ir.FPVectorEqual(16, operand, zero);
-
-    V(datasize, Vd, result);
-    return true;
+    return FPCompareAgainstZero(*this, Q, 16, Vn, Vd, ComparisonType::EQ);
 }
 
 bool TranslatorVisitor::FCMEQ_zero_4(bool Q, bool sz, Vec Vn, Vec Vd) {
-    return FPCompareAgainstZero(*this, Q, sz, Vn, Vd, ComparisonType::EQ);
+    return FPCompareAgainstZero(*this, Q, sz ? 64 : 32, Vn, Vd, ComparisonType::EQ);
+}
+
+bool TranslatorVisitor::FCMGE_zero_3(bool Q, Vec Vn, Vec Vd) {
+    return FPCompareAgainstZero(*this, Q, 16, Vn, Vd, ComparisonType::GE);
 }
 
 bool TranslatorVisitor::FCMGE_zero_4(bool Q, bool sz, Vec Vn, Vec Vd) {
-    return FPCompareAgainstZero(*this, Q, sz, Vn, Vd, ComparisonType::GE);
+    return FPCompareAgainstZero(*this, Q, sz ? 64 : 32, Vn, Vd, ComparisonType::GE);
+}
+
+bool TranslatorVisitor::FCMGT_zero_3(bool Q, Vec Vn, Vec Vd) {
+    return FPCompareAgainstZero(*this, Q, 16, Vn, Vd, ComparisonType::GT);
 }
 
 bool TranslatorVisitor::FCMGT_zero_4(bool Q, bool sz, Vec Vn, Vec Vd) {
-    return FPCompareAgainstZero(*this, Q, sz, Vn, Vd, ComparisonType::GT);
+    return FPCompareAgainstZero(*this, Q, sz ? 64 : 32, Vn, Vd, ComparisonType::GT);
+}
+
+bool TranslatorVisitor::FCMLE_3(bool Q, Vec Vn, Vec Vd) {
+    return FPCompareAgainstZero(*this, Q, 16, Vn, Vd, ComparisonType::LE);
 }
 
 bool TranslatorVisitor::FCMLE_4(bool Q, bool sz, Vec Vn, Vec Vd) {
-    return FPCompareAgainstZero(*this, Q, sz, Vn, Vd, ComparisonType::LE);
+    return FPCompareAgainstZero(*this, Q, sz ? 64 : 32, Vn, Vd, ComparisonType::LE);
+}
+
+bool TranslatorVisitor::FCMLT_3(bool Q, Vec Vn, Vec Vd) {
+    return FPCompareAgainstZero(*this, Q, 16, Vn, Vd, ComparisonType::LT);
 }
 
 bool TranslatorVisitor::FCMLT_4(bool Q, bool sz, Vec Vn, Vec Vd) {
-    return FPCompareAgainstZero(*this, Q, sz, Vn, Vd, ComparisonType::LT);
+    return FPCompareAgainstZero(*this, Q, sz ? 64 : 32, Vn, Vd, ComparisonType::LT);
 }
 
 bool TranslatorVisitor::FCVTL(bool Q, bool sz, Vec Vn, Vec Vd) {
@@ -31,6 +31,12 @@ struct TranslationOptions {
     /// If this is false, we treat the instruction as a NOP.
     /// If this is true, we emit an ExceptionRaised instruction.
     bool hook_hint_instructions = true;
+
+    /// This changes what IR we emit when we translate the SHA1C, SHA1M, SHA1P, SHA256H, SHA256H2,
+    /// SHA256SU0 and SHA256SU1 instructions.
+    /// If this is false, we expand these instructions into generic IR instructions.
+    /// If this is true, we emit dedicated SHA IR instructions, which the backend must support natively.
+    bool emit_sha_instructions = false;
 };
 
 /**
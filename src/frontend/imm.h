@@ -158,4 +158,8 @@ auto concatenate(Imm<first_bit_size> first, Imm<rest_bit_sizes> ...rest) {
     }
 }
 
+/// Expands an Advanced SIMD modified immediate (op:cmode:imm8) into its 64-bit form.
+/// This is equivalent to AdvSIMDExpandImm in ASL.
+u64 AdvSIMDExpandImm(bool op, Imm<4> cmode, Imm<8> imm8);
+
 } // namespace Dynarmic
@@ -433,6 +433,31 @@ U32U64 IREmitter::ExtractRegister(const U32U64& a, const U32U64& b, const U8& ls
     return Inst<U64>(Opcode::ExtractRegister64, a, b, lsb);
 }
 
+U32U64 IREmitter::UnsignedBitFieldExtract(const U32U64& a, const U8& lsb, const U8& width) {
+    if (a.GetType() == IR::Type::U32) {
+        return Inst<U32>(Opcode::UnsignedBitFieldExtract32, a, lsb, width);
+    }
+
+    return Inst<U64>(Opcode::UnsignedBitFieldExtract64, a, lsb, width);
+}
+
+U32U64 IREmitter::SignedBitFieldExtract(const U32U64& a, const U8& lsb, const U8& width) {
+    if (a.GetType() == IR::Type::U32) {
+        return Inst<U32>(Opcode::SignedBitFieldExtract32, a, lsb, width);
+    }
+
+    return Inst<U64>(Opcode::SignedBitFieldExtract64, a, lsb, width);
+}
+
+U32U64 IREmitter::BitFieldInsert(const U32U64& a, const U32U64& b, const U8& lsb, const U8& width) {
+    ASSERT(a.GetType() == b.GetType());
+    if (a.GetType() == IR::Type::U32) {
+        return Inst<U32>(Opcode::BitFieldInsert32, a, b, lsb, width);
+    }
+
+    return Inst<U64>(Opcode::BitFieldInsert64, a, b, lsb, width);
+}
+
 U32U64 IREmitter::MaxSigned(const U32U64& a, const U32U64& b) {
     if (a.GetType() == IR::Type::U32) {
         return Inst<U32>(Opcode::MaxSigned32, a, b);
@@ -773,10 +798,18 @@ U128 IREmitter::AESDecryptSingleRound(const U128& a) {
     return Inst<U128>(Opcode::AESDecryptSingleRound, a);
 }
 
+U128 IREmitter::AESDecryptSingleRoundAndInverseMixColumns(const U128& a) {
+    return Inst<U128>(Opcode::AESDecryptSingleRoundAndInverseMixColumns, a);
+}
+
 U128 IREmitter::AESEncryptSingleRound(const U128& a) {
     return Inst<U128>(Opcode::AESEncryptSingleRound, a);
 }
 
+U128 IREmitter::AESEncryptSingleRoundAndMixColumns(const U128& a) {
+    return Inst<U128>(Opcode::AESEncryptSingleRoundAndMixColumns, a);
+}
+
 U128 IREmitter::AESInverseMixColumns(const U128& a) {
     return Inst<U128>(Opcode::AESInverseMixColumns, a);
 }
@@ -785,8 +818,32 @@ U128 IREmitter::AESMixColumns(const U128& a) {
     return Inst<U128>(Opcode::AESMixColumns, a);
 }
 
-U8 IREmitter::SM4AccessSubstitutionBox(const U8& a) {
-    return Inst<U8>(Opcode::SM4AccessSubstitutionBox, a);
+U128 IREmitter::SHA1HashUpdateChoose(const U128& x, const U128& y, const U128& w) {
+    return Inst<U128>(Opcode::SHA1HashUpdateChoose, x, y, w);
+}
+
+U128 IREmitter::SHA1HashUpdateMajority(const U128& x, const U128& y, const U128& w) {
+    return Inst<U128>(Opcode::SHA1HashUpdateMajority, x, y, w);
+}
+
+U128 IREmitter::SHA1HashUpdateParity(const U128& x, const U128& y, const U128& w) {
+    return Inst<U128>(Opcode::SHA1HashUpdateParity, x, y, w);
+}
+
+U128 IREmitter::SHA256Hash(const U128& x, const U128& y, const U128& w, bool part1) {
+    return Inst<U128>(Opcode::SHA256Hash, x, y, w, Imm1(part1));
+}
+
+U128 IREmitter::SHA256MessageSchedule0(const U128& x, const U128& y) {
+    return Inst<U128>(Opcode::SHA256MessageSchedule0, x, y);
+}
+
+U128 IREmitter::SHA256MessageSchedule1(const U128& x, const U128& y, const U128& z) {
+    return Inst<U128>(Opcode::SHA256MessageSchedule1, x, y, z);
+}
+
+U128 IREmitter::SM4AccessSubstitutionBox(const U128& a) {
+    return Inst<U128>(Opcode::SM4AccessSubstitutionBox, a);
 }
 
 UAny IREmitter::VectorGetElement(size_t esize, const U128& a, size_t index) {
@@ -958,6 +1015,22 @@ U128 IREmitter::VectorDeinterleaveOdd(size_t esize, const U128& a, const U128& b
     return {};
 }
 
+U128 IREmitter::VectorDeinterleaveTriple(size_t esize, const U128& a, const U128& b, const U128& c, u8 index) {
+    ASSERT(index < 3);
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorDeinterleaveTriple8, a, b, c, Imm8(index));
+    case 16:
+        return Inst<U128>(Opcode::VectorDeinterleaveTriple16, a, b, c, Imm8(index));
+    case 32:
+        return Inst<U128>(Opcode::VectorDeinterleaveTriple32, a, b, c, Imm8(index));
+    case 64:
+        return Inst<U128>(Opcode::VectorDeinterleaveTriple64, a, b, c, Imm8(index));
+    }
+    UNREACHABLE();
+    return {};
+}
+
 U128 IREmitter::VectorEor(const U128& a, const U128& b) {
     return Inst<U128>(Opcode::VectorEor, a, b);
 }
@@ -1098,6 +1171,22 @@ U128 IREmitter::VectorInterleaveUpper(size_t esize, const U128& a, const U128& b
     return {};
 }
 
+U128 IREmitter::VectorInterleaveTriple(size_t esize, const U128& a, const U128& b, const U128& c, u8 index) {
+    ASSERT(index < 3);
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorInterleaveTriple8, a, b, c, Imm8(index));
+    case 16:
+        return Inst<U128>(Opcode::VectorInterleaveTriple16, a, b, c, Imm8(index));
+    case 32:
+        return Inst<U128>(Opcode::VectorInterleaveTriple32, a, b, c, Imm8(index));
+    case 64:
+        return Inst<U128>(Opcode::VectorInterleaveTriple64, a, b, c, Imm8(index));
+    }
+    UNREACHABLE();
+    return {};
+}
+
 U128 IREmitter::VectorLessEqualSigned(size_t esize, const U128& a, const U128& b) {
     return VectorNot(VectorGreaterSigned(esize, a, b));
 }
@@ -2254,6 +2343,8 @@ U128 IREmitter::FPVectorAbs(size_t esize, const U128& a) {
 
 U128 IREmitter::FPVectorAdd(size_t esize, const U128& a, const U128& b) {
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorAdd16, a, b);
     case 32:
         return Inst<U128>(Opcode::FPVectorAdd32, a, b);
     case 64:
@@ -2313,6 +2404,8 @@ U128 IREmitter::FPVectorFromUnsignedFixed(size_t esize, const U128& a, size_t fb
 
 U128 IREmitter::FPVectorGreater(size_t esize, const U128& a, const U128& b) {
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorGreater16, a, b);
     case 32:
         return Inst<U128>(Opcode::FPVectorGreater32, a, b);
     case 64:
@@ -2324,6 +2417,8 @@ U128 IREmitter::FPVectorGreater(size_t esize, const U128& a, const U128& b) {
 
 U128 IREmitter::FPVectorGreaterEqual(size_t esize, const U128& a, const U128& b) {
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorGreaterEqual16, a, b);
     case 32:
         return Inst<U128>(Opcode::FPVectorGreaterEqual32, a, b);
     case 64:
@@ -2357,6 +2452,8 @@ U128 IREmitter::FPVectorMin(size_t esize, const U128& a, const U128& b) {
 
 U128 IREmitter::FPVectorMul(size_t esize, const U128& a, const U128& b) {
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorMul16, a, b);
     case 32:
         return Inst<U128>(Opcode::FPVectorMul32, a, b);
     case 64:
@@ -2381,6 +2478,8 @@ U128 IREmitter::FPVectorMulAdd(size_t esize, const U128& a, const U128& b, const
 
 U128 IREmitter::FPVectorMulX(size_t esize, const U128& a, const U128& b) {
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorMulX16, a, b);
     case 32:
         return Inst<U128>(Opcode::FPVectorMulX32, a, b);
     case 64:
@@ -2506,6 +2605,8 @@ U128 IREmitter::FPVectorSqrt(size_t esize, const U128& a) {
 
 U128 IREmitter::FPVectorSub(size_t esize, const U128& a, const U128& b) {
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorSub16, a, b);
     case 32:
         return Inst<U128>(Opcode::FPVectorSub32, a, b);
     case 64:
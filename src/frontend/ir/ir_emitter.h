@@ -148,6 +148,9 @@ public:
     U64 ByteReverseDual(const U64& a);
     U32U64 CountLeadingZeros(const U32U64& a);
     U32U64 ExtractRegister(const U32U64& a, const U32U64& b, const U8& lsb);
+    U32U64 UnsignedBitFieldExtract(const U32U64& a, const U8& lsb, const U8& width);
+    U32U64 SignedBitFieldExtract(const U32U64& a, const U8& lsb, const U8& width);
+    U32U64 BitFieldInsert(const U32U64& a, const U32U64& b, const U8& lsb, const U8& width);
     U32U64 MaxSigned(const U32U64& a, const U32U64& b);
     U32U64 MaxUnsigned(const U32U64& a, const U32U64& b);
     U32U64 MinSigned(const U32U64& a, const U32U64& b);
@@ -206,11 +209,20 @@ public:
     U32 CRC32ISO64(const U32& a, const U64& b);
 
     U128 AESDecryptSingleRound(const U128& a);
+    U128 AESDecryptSingleRoundAndInverseMixColumns(const U128& a);
     U128 AESEncryptSingleRound(const U128& a);
+    U128 AESEncryptSingleRoundAndMixColumns(const U128& a);
     U128 AESInverseMixColumns(const U128& a);
     U128 AESMixColumns(const U128& a);
 
-    U8 SM4AccessSubstitutionBox(const U8& a);
+    U128 SHA1HashUpdateChoose(const U128& x, const U128& y, const U128& w);
+    U128 SHA1HashUpdateMajority(const U128& x, const U128& y, const U128& w);
+    U128 SHA1HashUpdateParity(const U128& x, const U128& y, const U128& w);
+    U128 SHA256Hash(const U128& x, const U128& y, const U128& w, bool part1);
+    U128 SHA256MessageSchedule0(const U128& x, const U128& y);
+    U128 SHA256MessageSchedule1(const U128& x, const U128& y, const U128& z);
+
+    U128 SM4AccessSubstitutionBox(const U128& a);
 
     UAny VectorGetElement(size_t esize, const U128& a, size_t index);
     U128 VectorSetElement(size_t esize, const U128& a, size_t index, const UAny& elem);
@@ -225,6 +237,7 @@ public:
     U128 VectorEor(const U128& a, const U128& b);
     U128 VectorDeinterleaveEven(size_t esize, const U128& a, const U128& b);
     U128 VectorDeinterleaveOdd(size_t esize, const U128& a, const U128& b);
+    U128 VectorDeinterleaveTriple(size_t esize, const U128& a, const U128& b, const U128& c, u8 index);
     U128 VectorEqual(size_t esize, const U128& a, const U128& b);
     U128 VectorExtract(const U128& a, const U128& b, size_t position);
     U128 VectorExtractLower(const U128& a, const U128& b, size_t position);
@@ -238,6 +251,7 @@ public:
     U128 VectorHalvingSubUnsigned(size_t esize, const U128& a, const U128& b);
     U128 VectorInterleaveLower(size_t esize, const U128& a, const U128& b);
     U128 VectorInterleaveUpper(size_t esize, const U128& a, const U128& b);
+    U128 VectorInterleaveTriple(size_t esize, const U128& a, const U128& b, const U128& c, u8 index);
     U128 VectorLessEqualSigned(size_t esize, const U128& a, const U128& b);
     U128 VectorLessEqualUnsigned(size_t esize, const U128& a, const U128& b);
     U128 VectorLessSigned(size_t esize, const U128& a, const U128& b);
@@ -71,6 +71,13 @@ bool Inst::IsSharedMemoryRead() const {
     case Opcode::A64ReadMemory32:
     case Opcode::A64ReadMemory64:
     case Opcode::A64ReadMemory128:
+    case Opcode::A64PagedReadMemory8:
+    case Opcode::A64PagedReadMemory16:
+    case Opcode::A64PagedReadMemory32:
+    case Opcode::A64PagedReadMemory64:
+    case Opcode::A64PagedReadMemory128:
+    case Opcode::A64PagedReadMemoryPair32:
+    case Opcode::A64PagedReadMemoryPair64:
         return true;
 
     default:
@@ -89,6 +96,11 @@ bool Inst::IsSharedMemoryWrite() const {
     case Opcode::A64WriteMemory32:
     case Opcode::A64WriteMemory64:
     case Opcode::A64WriteMemory128:
+    case Opcode::A64PagedWriteMemory8:
+    case Opcode::A64PagedWriteMemory16:
+    case Opcode::A64PagedWriteMemory32:
+    case Opcode::A64PagedWriteMemory64:
+    case Opcode::A64PagedWriteMemory128:
         return true;
 
     default:
@@ -185,6 +197,7 @@ bool Inst::ReadsFromCoreRegister() const {
     case Opcode::A32GetRegister:
     case Opcode::A32GetExtendedRegister32:
     case Opcode::A32GetExtendedRegister64:
+    case Opcode::A32GetVector:
     case Opcode::A64GetW:
     case Opcode::A64GetX:
     case Opcode::A64GetS:
@@ -203,6 +216,7 @@ bool Inst::WritesToCoreRegister() const {
     case Opcode::A32SetRegister:
     case Opcode::A32SetExtendedRegister32:
     case Opcode::A32SetExtendedRegister64:
+    case Opcode::A32SetVector:
     case Opcode::A32BXWritePC:
     case Opcode::A64SetW:
     case Opcode::A64SetX:
@@ -335,6 +349,7 @@ bool Inst::ReadsFromAndWritesToFPSRCumulativeExceptionBits() const {
     case Opcode::FPFixedS32ToDouble:
     case Opcode::FPFixedS64ToDouble:
     case Opcode::FPFixedS64ToSingle:
+    case Opcode::FPVectorAdd16:
     case Opcode::FPVectorAdd32:
     case Opcode::FPVectorAdd64:
     case Opcode::FPVectorDiv32:
@@ -346,10 +361,13 @@ bool Inst::ReadsFromAndWritesToFPSRCumulativeExceptionBits() const {
     case Opcode::FPVectorFromSignedFixed64:
     case Opcode::FPVectorFromUnsignedFixed32:
     case Opcode::FPVectorFromUnsignedFixed64:
+    case Opcode::FPVectorGreater16:
     case Opcode::FPVectorGreater32:
     case Opcode::FPVectorGreater64:
+    case Opcode::FPVectorGreaterEqual16:
     case Opcode::FPVectorGreaterEqual32:
     case Opcode::FPVectorGreaterEqual64:
+    case Opcode::FPVectorMul16:
     case Opcode::FPVectorMul32:
     case Opcode::FPVectorMul64:
     case Opcode::FPVectorMulAdd16:
@@ -376,6 +394,7 @@ bool Inst::ReadsFromAndWritesToFPSRCumulativeExceptionBits() const {
     case Opcode::FPVectorRSqrtStepFused64:
     case Opcode::FPVectorSqrt32:
     case Opcode::FPVectorSqrt64:
+    case Opcode::FPVectorSub16:
     case Opcode::FPVectorSub32:
     case Opcode::FPVectorSub64:
     case Opcode::FPVectorToSignedFixed16:
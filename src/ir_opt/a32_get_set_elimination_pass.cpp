@@ -117,6 +117,25 @@ void A32GetSetElimination(IR::Block& block) {
             }
             break;
         }
+        case IR::Opcode::A32GetVector:
+        case IR::Opcode::A32SetVector: {
+            // Vector accesses are not tracked. Forget everything we know about the aliased registers
+            // so that earlier sets are neither forwarded to later gets nor eliminated.
+            const A32::ExtReg reg = inst->GetArg(0).GetA32ExtRegRef();
+            const size_t doubles_count = A32::IsDoubleExtReg(reg) ? 1 : 2;
+            const size_t doubles_reg_index = A32::IsDoubleExtReg(reg) ? A32::RegNumber(reg) : A32::RegNumber(reg) * 2;
+
+            for (size_t i = doubles_reg_index; i < doubles_reg_index + doubles_count; i++) {
+                ext_reg_doubles_info[i] = {};
+
+                const size_t singles_reg_index = i * 2;
+                if (singles_reg_index < ext_reg_singles_info.size()) {
+                    ext_reg_singles_info[singles_reg_index] = {};
+                    ext_reg_singles_info[singles_reg_index+1] = {};
+                }
+            }
+            break;
+        }
         case IR::Opcode::A32SetNFlag: {
             do_set(cpsr_info.n, inst->GetArg(0), inst);
             break;
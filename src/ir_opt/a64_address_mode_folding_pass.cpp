@@ -0,0 +1,120 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "common/common_types.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+#include "frontend/ir/value.h"
+#include "ir_opt/passes.h"
+
+namespace Dynarmic::Optimization {
+namespace {
+
+IR::Value ResolveIdentity(IR::Value value) {
+    while (!value.IsImmediate() && value.GetInst()->GetOpcode() == IR::Opcode::Identity) {
+        value = value.GetInst()->GetArg(0);
+    }
+    return value;
+}
+
+bool IsFoldableMemoryAccess(IR::Opcode op) {
+    switch (op) {
+    case IR::Opcode::A64ReadMemory8:
+    case IR::Opcode::A64ReadMemory16:
+    case IR::Opcode::A64ReadMemory32:
+    case IR::Opcode::A64ReadMemory64:
+    case IR::Opcode::A64ReadMemory128:
+    case IR::Opcode::A64WriteMemory8:
+    case IR::Opcode::A64WriteMemory16:
+    case IR::Opcode::A64WriteMemory32:
+    case IR::Opcode::A64WriteMemory64:
+    case IR::Opcode::A64WriteMemory128:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool FitsInS32(u64 value) {
+    return static_cast<s64>(value) == static_cast<s32>(value);
+}
+
+/// Folds an address of the form base + disp, base - disp, base + index or base + (index << shift)
+/// into the addressing operands of a memory access, so that no separate addition needs to be emitted.
+void FoldAddress(IR::Inst& inst) {
+    const IR::Value offset = inst.GetArg(1);
+    if (!offset.IsImmediate() || offset.GetU64() != 0) {
+        return;
+    }
+
+    const IR::Value address = ResolveIdentity(inst.GetArg(0));
+    if (address.IsImmediate()) {
+        return;
+    }
+
+    IR::Inst* const add = address.GetInst();
+    if (add->UseCount() != 1 || add->HasAssociatedPseudoOperation()) {
+        return;
+    }
+
+    const bool is_add = add->GetOpcode() == IR::Opcode::Add64;
+    const bool is_sub = add->GetOpcode() == IR::Opcode::Sub64;
+    if (!is_add && !is_sub) {
+        return;
+    }
+
+    const IR::Value base = ResolveIdentity(add->GetArg(0));
+    const IR::Value rhs = ResolveIdentity(add->GetArg(1));
+    const IR::Value carry = add->GetArg(2);
+    if (base.IsImmediate() || !carry.IsImmediate() || carry.GetU1() != is_sub) {
+        return;
+    }
+
+    if (rhs.IsImmediate()) {
+        const u64 displacement = is_add ? rhs.GetU64() : 0 - rhs.GetU64();
+        if (!FitsInS32(displacement)) {
+            return;
+        }
+
+        inst.SetArg(0, base);
+        inst.SetArg(1, IR::Value{displacement});
+        return;
+    }
+
+    if (is_sub) {
+        return;
+    }
+
+    IR::Value index = rhs;
+    u8 shift = 0;
+
+    IR::Inst* const shift_inst = index.GetInst();
+    if (shift_inst->GetOpcode() == IR::Opcode::LogicalShiftLeft64 && shift_inst->UseCount() == 1) {
+        const IR::Value amount = shift_inst->GetArg(1);
+        const IR::Value shifted = ResolveIdentity(shift_inst->GetArg(0));
+        if (amount.IsImmediate() && amount.GetU8() <= 3 && !shifted.IsImmediate()) {
+            index = shifted;
+            shift = amount.GetU8();
+        }
+    }
+
+    inst.SetArg(0, base);
+    inst.SetArg(1, index);
+    inst.SetArg(2, IR::Value{shift});
+}
+
+} // Anonymous namespace
+
+void A64AddressModeFolding(IR::Block& block) {
+    for (auto& inst : block) {
+        if (IsFoldableMemoryAccess(inst.GetOpcode())) {
+            FoldAddress(inst);
+        }
+    }
+}
+
+} // namespace Dynarmic::Optimization
@@ -0,0 +1,110 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include <dynarmic/A64/config.h>
+
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/ir_emitter.h"
+#include "frontend/ir/opcodes.h"
+#include "ir_opt/passes.h"
+
+namespace Dynarmic::Optimization {
+namespace {
+
+IR::U128 MakeVector(IR::IREmitter& ir, const A64::Vector& value) {
+    const auto [lower, upper] = value;
+    if (lower == 0 && upper == 0) {
+        return ir.ZeroVector();
+    }
+    if (upper == 0) {
+        return ir.ZeroExtendToQuad(ir.Imm64(lower));
+    }
+    if (lower == upper) {
+        return ir.VectorBroadcast(64, ir.Imm64(lower));
+    }
+    return ir.VectorSetElement(64, ir.ZeroExtendToQuad(ir.Imm64(lower)), 1, ir.Imm64(upper));
+}
+
+u64 GetVAddr(const IR::Inst& inst) {
+    return inst.GetArg(0).GetU64() + (inst.GetArg(1).GetU64() << inst.GetArg(2).GetU8());
+}
+
+} // Anonymous namespace
+
+void A64ConstantMemoryReads(IR::Block& block, A64::UserCallbacks* cb) {
+    for (auto& inst : block) {
+        switch (inst.GetOpcode()) {
+        case IR::Opcode::A64ReadMemory8: {
+            if (!inst.AreAllArgsImmediates()) {
+                break;
+            }
+
+            const u64 vaddr = GetVAddr(inst);
+            if (cb->IsReadOnlyMemory(vaddr)) {
+                const u8 value_from_memory = cb->MemoryRead8(vaddr);
+                inst.ReplaceUsesWith(IR::Value{value_from_memory});
+            }
+            break;
+        }
+        case IR::Opcode::A64ReadMemory16: {
+            if (!inst.AreAllArgsImmediates()) {
+                break;
+            }
+
+            const u64 vaddr = GetVAddr(inst);
+            if (cb->IsReadOnlyMemory(vaddr)) {
+                const u16 value_from_memory = cb->MemoryRead16(vaddr);
+                inst.ReplaceUsesWith(IR::Value{value_from_memory});
+            }
+            break;
+        }
+        case IR::Opcode::A64ReadMemory32: {
+            if (!inst.AreAllArgsImmediates()) {
+                break;
+            }
+
+            const u64 vaddr = GetVAddr(inst);
+            if (cb->IsReadOnlyMemory(vaddr)) {
+                const u32 value_from_memory = cb->MemoryRead32(vaddr);
+                inst.ReplaceUsesWith(IR::Value{value_from_memory});
+            }
+            break;
+        }
+        case IR::Opcode::A64ReadMemory64: {
+            if (!inst.AreAllArgsImmediates()) {
+                break;
+            }
+
+            const u64 vaddr = GetVAddr(inst);
+            if (cb->IsReadOnlyMemory(vaddr)) {
+                const u64 value_from_memory = cb->MemoryRead64(vaddr);
+                inst.ReplaceUsesWith(IR::Value{value_from_memory});
+            }
+            break;
+        }
+        case IR::Opcode::A64ReadMemory128: {
+            if (!inst.AreAllArgsImmediates()) {
+                break;
+            }
+
+            // A 128-bit immediate cannot be represented directly, so the vector is rebuilt from its halves.
+            const u64 vaddr = GetVAddr(inst);
+            if (cb->IsReadOnlyMemory(vaddr)) {
+                const A64::Vector value_from_memory = cb->MemoryRead128(vaddr);
+
+                IR::IREmitter ir{block};
+                ir.SetInsertionPoint(&inst);
+                inst.ReplaceUsesWith(MakeVector(ir, value_from_memory));
+            }
+            break;
+        }
+        default:
+            break;
+        }
+    }
+}
+
+} // namespace Dynarmic::Optimization
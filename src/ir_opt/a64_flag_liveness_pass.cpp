@@ -0,0 +1,173 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "common/common_types.h"
+#include "common/iterator_util.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/cond.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+#include "frontend/ir/value.h"
+#include "ir_opt/passes.h"
+
+namespace Dynarmic::Optimization {
+namespace {
+
+enum Flags : u32 {
+    None = 0,
+    N = 1 << 3,
+    Z = 1 << 2,
+    C = 1 << 1,
+    V = 1 << 0,
+    All = N | Z | C | V,
+};
+
+u32 FlagsReadByCond(IR::Cond cond) {
+    switch (cond) {
+    case IR::Cond::EQ:
+    case IR::Cond::NE:
+        return Z;
+    case IR::Cond::CS:
+    case IR::Cond::CC:
+        return C;
+    case IR::Cond::MI:
+    case IR::Cond::PL:
+        return N;
+    case IR::Cond::VS:
+    case IR::Cond::VC:
+        return V;
+    case IR::Cond::HI:
+    case IR::Cond::LS:
+        return C | Z;
+    case IR::Cond::GE:
+    case IR::Cond::LT:
+        return N | V;
+    case IR::Cond::GT:
+    case IR::Cond::LE:
+        return N | Z | V;
+    case IR::Cond::AL:
+    case IR::Cond::NV:
+        return None;
+    }
+    return All;
+}
+
+u32 FlagsReadBy(const IR::Inst& inst) {
+    switch (inst.GetOpcode()) {
+    case IR::Opcode::ConditionalSelect32:
+    case IR::Opcode::ConditionalSelect64:
+    case IR::Opcode::ConditionalSelectNZCV:
+        return FlagsReadByCond(inst.GetArg(0).GetCond());
+    case IR::Opcode::A64GetCFlag:
+        return C;
+    case IR::Opcode::A64DataCacheOperationRaised:
+        return All;
+    default:
+        break;
+    }
+
+    // Leaving the block mid-way exposes the full guest state.
+    if (inst.ReadsFromCPSR() || inst.CausesCPUException()) {
+        return All;
+    }
+    return None;
+}
+
+/// Returns the instruction whose NZCV result a SetNZCV stores, if it is one whose carry out is available separately.
+IR::Inst* GetFlagSource(const IR::Inst& set_nzcv) {
+    const IR::Value nzcv = set_nzcv.GetArg(0);
+    if (nzcv.IsImmediate() || nzcv.GetInst()->GetOpcode() != IR::Opcode::GetNZCVFromOp) {
+        return nullptr;
+    }
+
+    const IR::Value source = nzcv.GetInst()->GetArg(0);
+    return source.IsImmediate() ? nullptr : source.GetInst();
+}
+
+// A GetCFlag that follows a SetNZCV in the same block reads the carry out of the flag-setting
+// operation, so it can be taken directly from that operation instead of from the stored NZCV.
+void ForwardCarryFlag(IR::Block& block) {
+    IR::Inst* flag_source = nullptr;
+
+    for (auto iter = block.begin(); iter != block.end(); ++iter) {
+        auto& inst = *iter;
+
+        switch (inst.GetOpcode()) {
+        case IR::Opcode::A64SetNZCV:
+            flag_source = GetFlagSource(inst);
+            break;
+        case IR::Opcode::A64GetCFlag: {
+            if (!flag_source) {
+                break;
+            }
+
+            switch (flag_source->GetOpcode()) {
+            case IR::Opcode::Add32:
+            case IR::Opcode::Add64:
+            case IR::Opcode::Sub32:
+            case IR::Opcode::Sub64: {
+                IR::Inst* carry = flag_source->GetAssociatedPseudoOperation(IR::Opcode::GetCarryFromOp);
+                if (!carry) {
+                    carry = &*block.PrependNewInst(iter, IR::Opcode::GetCarryFromOp, {IR::Value{flag_source}});
+                }
+                inst.ReplaceUsesWith(IR::Value{carry});
+                break;
+            }
+            case IR::Opcode::And32:
+            case IR::Opcode::And64:
+            case IR::Opcode::Eor32:
+            case IR::Opcode::Eor64:
+            case IR::Opcode::Or32:
+            case IR::Opcode::Or64:
+            case IR::Opcode::Not32:
+            case IR::Opcode::Not64:
+                // Logical operations always clear the carry flag.
+                inst.ReplaceUsesWith(IR::Value{false});
+                break;
+            default:
+                break;
+            }
+            break;
+        }
+        default:
+            if (inst.WritesToCPSR()) {
+                flag_source = nullptr;
+            }
+            break;
+        }
+    }
+}
+
+// Backwards per-flag liveness: all flags are live out of the block, as its successors and the
+// terminal may read any of them. A write to NZCV none of whose flags are read before they are
+// overwritten is removed, which in turn leaves its flag computation to dead code elimination.
+void RemoveDeadFlagWrites(IR::Block& block) {
+    u32 live = All;
+
+    for (auto& inst : Common::Reverse(block)) {
+        switch (inst.GetOpcode()) {
+        case IR::Opcode::A64SetNZCV:
+        case IR::Opcode::A64SetNZCVRaw:
+            if (live == None) {
+                inst.Invalidate();
+            }
+            live = None;
+            break;
+        default:
+            live |= FlagsReadBy(inst);
+            break;
+        }
+    }
+}
+
+} // Anonymous namespace
+
+void A64FlagLiveness(IR::Block& block) {
+    ForwardCarryFlag(block);
+    RemoveDeadFlagWrites(block);
+}
+
+} // namespace Dynarmic::Optimization
@@ -0,0 +1,92 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include "common/common_types.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+#include "frontend/ir/value.h"
+#include "ir_opt/passes.h"
+
+namespace Dynarmic::Optimization {
+namespace {
+
+/// Loads may not be moved across these, as they either access or order memory, or may call into user code.
+bool IsReorderBarrier(const IR::Inst& inst) {
+    switch (inst.GetOpcode()) {
+    case IR::Opcode::A64DataCacheOperationRaised:
+    case IR::Opcode::A64GetCNTPCT:
+        return true;
+    default:
+        break;
+    }
+
+    return inst.IsMemoryReadOrWrite()
+        || inst.IsBarrier()
+        || inst.AltersExclusiveState()
+        || inst.CausesCPUException()
+        || inst.IsSetCheckBitOperation()
+        || inst.IsCoprocessorInstruction();
+}
+
+/// Determines if `second` loads the element immediately above the one `first` loads, through the same page handle.
+bool IsAdjacentLoad(const IR::Inst& first, const IR::Inst& second, u64 element_size) {
+    return first.GetOpcode() == second.GetOpcode()
+        && first.GetArg(0).GetInst() == second.GetArg(0).GetInst()
+        && first.GetArg(1).GetInst() == second.GetArg(1).GetInst()
+        && first.GetArg(2).GetU64() + element_size == second.GetArg(2).GetU64();
+}
+
+void MergeLoads(IR::Block& block, IR::Inst& first, IR::Inst& second) {
+    const IR::Block::iterator insertion_point{&first};
+
+    if (first.GetOpcode() == IR::Opcode::A64PagedReadMemory32) {
+        const IR::Value pair{&*block.PrependNewInst(insertion_point, IR::Opcode::A64PagedReadMemoryPair32, {first.GetArg(0), first.GetArg(1), first.GetArg(2)})};
+        const IR::Value lower{&*block.PrependNewInst(insertion_point, IR::Opcode::LeastSignificantWord, {pair})};
+        const IR::Value upper{&*block.PrependNewInst(insertion_point, IR::Opcode::MostSignificantWord, {pair})};
+        first.ReplaceUsesWith(lower);
+        second.ReplaceUsesWith(upper);
+        return;
+    }
+
+    const IR::Value pair{&*block.PrependNewInst(insertion_point, IR::Opcode::A64PagedReadMemoryPair64, {first.GetArg(0), first.GetArg(1), first.GetArg(2)})};
+    const IR::Value lower{&*block.PrependNewInst(insertion_point, IR::Opcode::VectorGetElement64, {pair, IR::Value{u8(0)}})};
+    const IR::Value upper{&*block.PrependNewInst(insertion_point, IR::Opcode::VectorGetElement64, {pair, IR::Value{u8(1)}})};
+    first.ReplaceUsesWith(lower);
+    second.ReplaceUsesWith(upper);
+}
+
+} // Anonymous namespace
+
+// Two loads of consecutive elements through the same page handle are known to be within one page
+// whenever the handle is valid, and so can be performed as one wider host load. Only loads are
+// merged: assembling the wider value for a store costs more than the store it would save.
+void A64MemoryPairMerging(IR::Block& block) {
+    IR::Inst* pending = nullptr;
+
+    for (auto& inst : block) {
+        switch (inst.GetOpcode()) {
+        case IR::Opcode::A64PagedReadMemory32:
+        case IR::Opcode::A64PagedReadMemory64: {
+            const u64 element_size = inst.GetOpcode() == IR::Opcode::A64PagedReadMemory32 ? 4 : 8;
+            if (pending && IsAdjacentLoad(*pending, inst, element_size)) {
+                MergeLoads(block, *pending, inst);
+                pending = nullptr;
+            } else {
+                pending = &inst;
+            }
+            break;
+        }
+        default:
+            if (IsReorderBarrier(inst)) {
+                pending = nullptr;
+            }
+            break;
+        }
+    }
+}
+
+} // namespace Dynarmic::Optimization
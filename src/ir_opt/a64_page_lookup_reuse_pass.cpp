@@ -0,0 +1,222 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include <algorithm>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <dynarmic/A64/config.h>
+
+#include "common/assert.h"
+#include "common/common_types.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+#include "frontend/ir/value.h"
+#include "ir_opt/passes.h"
+
+namespace Dynarmic::Optimization {
+namespace {
+
+constexpr s64 page_size = 0x1000;
+
+/// A memory access at a constant displacement from a base value.
+struct Access {
+    IR::Inst* inst;
+    IR::Inst* base;
+    s64 displacement;
+    size_t bitsize;
+    bool is_write;
+};
+
+/// Accesses from a common base that all lie within [base + first, base + last].
+struct PageGroup {
+    IR::Inst* base;
+    s64 first;
+    s64 last;
+    std::vector<Access> accesses;
+};
+
+IR::Value ResolveIdentity(IR::Value value) {
+    while (!value.IsImmediate() && value.GetInst()->GetOpcode() == IR::Opcode::Identity) {
+        value = value.GetInst()->GetArg(0);
+    }
+    return value;
+}
+
+bool FitsInS32(s64 value) {
+    return value == static_cast<s32>(value);
+}
+
+std::optional<Access> DecodeAccess(IR::Inst& inst, const A64::UserConfig& conf) {
+    const auto [bitsize, is_write] = [&]() -> std::pair<size_t, bool> {
+        switch (inst.GetOpcode()) {
+        case IR::Opcode::A64ReadMemory8:
+            return {8, false};
+        case IR::Opcode::A64ReadMemory16:
+            return {16, false};
+        case IR::Opcode::A64ReadMemory32:
+            return {32, false};
+        case IR::Opcode::A64ReadMemory64:
+            return {64, false};
+        case IR::Opcode::A64ReadMemory128:
+            return {128, false};
+        case IR::Opcode::A64WriteMemory8:
+            return {8, true};
+        case IR::Opcode::A64WriteMemory16:
+            return {16, true};
+        case IR::Opcode::A64WriteMemory32:
+            return {32, true};
+        case IR::Opcode::A64WriteMemory64:
+            return {64, true};
+        case IR::Opcode::A64WriteMemory128:
+            return {128, true};
+        default:
+            return {0, false};
+        }
+    }();
+
+    if (bitsize == 0) {
+        return std::nullopt;
+    }
+
+    // Misalignment detection has to be done on each individual access.
+    if (bitsize != 8 && (conf.detect_misaligned_access_via_page_table & bitsize) != 0) {
+        return std::nullopt;
+    }
+
+    const IR::Value base = ResolveIdentity(inst.GetArg(0));
+    const IR::Value offset = inst.GetArg(1);
+    if (base.IsImmediate() || !offset.IsImmediate() || inst.GetArg(2).GetU8() != 0) {
+        return std::nullopt;
+    }
+
+    const s64 displacement = static_cast<s64>(offset.GetU64());
+    if (!FitsInS32(displacement) || !FitsInS32(displacement + static_cast<s64>(bitsize / 8) - 1)) {
+        return std::nullopt;
+    }
+
+    return Access{&inst, base.GetInst(), displacement, bitsize, is_write};
+}
+
+/// Instructions which may call into user code that could remap memory.
+bool EndsPageGroups(const IR::Inst& inst) {
+    switch (inst.GetOpcode()) {
+    case IR::Opcode::A64DataCacheOperationRaised:
+    case IR::Opcode::A64GetCNTPCT:
+        return true;
+    default:
+        break;
+    }
+
+    return inst.IsBarrier()
+        || inst.AltersExclusiveState()
+        || inst.CausesCPUException()
+        || inst.IsSetCheckBitOperation()
+        || inst.IsCoprocessorInstruction();
+}
+
+IR::Opcode PagedOpcode(const Access& access) {
+    switch (access.bitsize) {
+    case 8:
+        return access.is_write ? IR::Opcode::A64PagedWriteMemory8 : IR::Opcode::A64PagedReadMemory8;
+    case 16:
+        return access.is_write ? IR::Opcode::A64PagedWriteMemory16 : IR::Opcode::A64PagedReadMemory16;
+    case 32:
+        return access.is_write ? IR::Opcode::A64PagedWriteMemory32 : IR::Opcode::A64PagedReadMemory32;
+    case 64:
+        return access.is_write ? IR::Opcode::A64PagedWriteMemory64 : IR::Opcode::A64PagedReadMemory64;
+    case 128:
+        return access.is_write ? IR::Opcode::A64PagedWriteMemory128 : IR::Opcode::A64PagedReadMemory128;
+    }
+    UNREACHABLE();
+}
+
+std::vector<PageGroup> FindPageGroups(IR::Block& block, const A64::UserConfig& conf) {
+    std::vector<PageGroup> open;
+    std::vector<PageGroup> closed;
+
+    const auto close = [&](auto iter) {
+        closed.emplace_back(std::move(*iter));
+        return open.erase(iter);
+    };
+
+    for (auto& inst : block) {
+        if (EndsPageGroups(inst)) {
+            while (!open.empty()) {
+                close(open.begin());
+            }
+            continue;
+        }
+
+        const auto access = DecodeAccess(inst, conf);
+        if (!access) {
+            continue;
+        }
+
+        const s64 first = access->displacement;
+        const s64 last = access->displacement + static_cast<s64>(access->bitsize / 8) - 1;
+
+        auto iter = std::find_if(open.begin(), open.end(), [&](const auto& group) { return group.base == access->base; });
+        if (iter != open.end()) {
+            const s64 new_first = std::min(iter->first, first);
+            const s64 new_last = std::max(iter->last, last);
+            if (new_last - new_first < page_size) {
+                iter->first = new_first;
+                iter->last = new_last;
+                iter->accesses.push_back(*access);
+                continue;
+            }
+            close(iter);
+        }
+
+        open.push_back({access->base, first, last, {*access}});
+    }
+
+    while (!open.empty()) {
+        close(open.begin());
+    }
+
+    // A single access gains nothing from a separate lookup.
+    closed.erase(std::remove_if(closed.begin(), closed.end(), [](const auto& group) {
+        return group.accesses.size() < 2;
+    }), closed.end());
+
+    return closed;
+}
+
+} // Anonymous namespace
+
+void A64PageLookupReuse(IR::Block& block, const A64::UserConfig& conf) {
+    if (!conf.page_table) {
+        return;
+    }
+
+    for (const auto& group : FindPageGroups(block, conf)) {
+        const IR::Block::iterator first_access{group.accesses.front().inst};
+        const IR::Value handle{&*block.PrependNewInst(first_access, IR::Opcode::A64GetPageHandle, {
+            IR::Value{group.base},
+            IR::Value{static_cast<u64>(group.first)},
+            IR::Value{static_cast<u64>(group.last)},
+        })};
+
+        for (const auto& access : group.accesses) {
+            IR::Inst& inst = *access.inst;
+            const IR::Value displacement{static_cast<u64>(access.displacement)};
+
+            if (access.is_write) {
+                block.PrependNewInst(IR::Block::iterator{&inst}, PagedOpcode(access), {handle, IR::Value{access.base}, displacement, inst.GetArg(3)});
+                inst.Invalidate();
+            } else {
+                const auto paged = block.PrependNewInst(IR::Block::iterator{&inst}, PagedOpcode(access), {handle, IR::Value{access.base}, displacement});
+                inst.ReplaceUsesWith(IR::Value{&*paged});
+            }
+        }
+    }
+}
+
+} // namespace Dynarmic::Optimization
@@ -0,0 +1,118 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include <array>
+#include <map>
+#include <optional>
+#include <tuple>
+
+#include "common/common_types.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+#include "frontend/ir/value.h"
+#include "ir_opt/passes.h"
+
+namespace Dynarmic::Optimization {
+namespace {
+
+// An argument is identified either by the immediate it holds or by the instruction that produces it.
+using ArgumentKey = std::tuple<bool, IR::Type, u64>;
+using InstructionKey = std::tuple<IR::Opcode, std::array<ArgumentKey, IR::max_arg_count>>;
+
+IR::Value ResolveIdentity(IR::Value value) {
+    while (!value.IsImmediate() && value.GetInst()->GetOpcode() == IR::Opcode::Identity) {
+        value = value.GetInst()->GetArg(0);
+    }
+    return value;
+}
+
+// Reads of state that may change within a block, even in the absence of an intervening write in the IR.
+bool ReadsFromVolatileState(const IR::Inst& inst) {
+    switch (inst.GetOpcode()) {
+    case IR::Opcode::A64GetCNTFRQ:
+    case IR::Opcode::A64GetCNTPCT:
+    case IR::Opcode::A64GetCTR:
+    case IR::Opcode::A64GetDCZID:
+    case IR::Opcode::A64GetTPIDR:
+    case IR::Opcode::A64GetTPIDRRO:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/// Only instructions whose result is fully determined by their opcode and arguments are candidates for merging.
+bool IsCandidate(const IR::Inst& inst) {
+    if (inst.GetOpcode() == IR::Opcode::Identity || inst.GetType() == IR::Type::Void) {
+        return false;
+    }
+
+    // Pseudo-operations are tied to their parent instruction, and a parent may have at most one of each kind.
+    if (inst.IsAPseudoOperation() || inst.HasAssociatedPseudoOperation()) {
+        return false;
+    }
+
+    return !inst.MayHaveSideEffects()
+        && !inst.IsMemoryRead()
+        && !inst.ReadsFromCoreRegister()
+        && !inst.ReadsFromCPSR()
+        && !inst.ReadsFromFPCR()
+        && !inst.ReadsFromFPSR()
+        && !inst.IsCoprocessorInstruction()
+        && !ReadsFromVolatileState(inst);
+}
+
+std::optional<InstructionKey> MakeKey(const IR::Inst& inst) {
+    std::array<ArgumentKey, IR::max_arg_count> args{};
+
+    for (size_t i = 0; i < inst.NumArgs(); i++) {
+        const IR::Value arg = ResolveIdentity(inst.GetArg(i));
+
+        if (!arg.IsImmediate()) {
+            args[i] = {false, IR::Type::Opaque, reinterpret_cast<u64>(arg.GetInst())};
+            continue;
+        }
+
+        switch (arg.GetType()) {
+        case IR::Type::U1:
+        case IR::Type::U8:
+        case IR::Type::U16:
+        case IR::Type::U32:
+        case IR::Type::U64:
+            args[i] = {true, arg.GetType(), arg.GetImmediateAsU64()};
+            break;
+        default:
+            return std::nullopt;
+        }
+    }
+
+    return InstructionKey{inst.GetOpcode(), args};
+}
+
+} // Anonymous namespace
+
+void CommonSubexpressionElimination(IR::Block& block) {
+    std::map<InstructionKey, IR::Inst*> available;
+
+    for (auto& inst : block) {
+        if (!IsCandidate(inst)) {
+            continue;
+        }
+
+        const auto key = MakeKey(inst);
+        if (!key) {
+            continue;
+        }
+
+        const auto [iter, inserted] = available.emplace(*key, &inst);
+        if (!inserted) {
+            inst.ReplaceUsesWith(IR::Value{iter->second});
+        }
+    }
+}
+
+} // namespace Dynarmic::Optimization
@@ -4,9 +4,14 @@
  * General Public License version 2 or any later version.
  */
 
+#include <array>
+#include <optional>
+
 #include "common/bit_util.h"
 #include "common/common_types.h"
 #include "frontend/ir/basic_block.h"
+#include "frontend/ir/cond.h"
+#include "frontend/ir/ir_emitter.h"
 #include "frontend/ir/opcodes.h"
 #include "ir_opt/passes.h"
 
@@ -23,6 +28,148 @@ void ReplaceUsesWith(IR::Inst& inst, bool is_32_bit, u64 value) {
     }
 }
 
+IR::Value MakeImmediate(bool is_32_bit, u64 value) {
+    return is_32_bit ? IR::Value{static_cast<u32>(value)} : IR::Value{value};
+}
+
+// Looks through any chain of Identity instructions.
+IR::Value Resolve(IR::Value value) {
+    while (!value.IsImmediate() && value.GetInst()->GetOpcode() == IR::Opcode::Identity) {
+        value = value.GetInst()->GetArg(0);
+    }
+    return value;
+}
+
+// Determines whether two values are known to be identical.
+bool IsSameValue(const IR::Value& lhs, const IR::Value& rhs) {
+    const IR::Value a = Resolve(lhs);
+    const IR::Value b = Resolve(rhs);
+
+    if (a.IsImmediate() || b.IsImmediate()) {
+        return a.IsImmediate() && b.IsImmediate() && a.GetType() == b.GetType() && a.GetImmediateAsU64() == b.GetImmediateAsU64();
+    }
+    return a.GetInst() == b.GetInst();
+}
+
+// Returns the instruction producing value, if it is an instruction with the given opcode.
+IR::Inst* GetProducer(const IR::Value& value, IR::Opcode opcode) {
+    const IR::Value resolved = Resolve(value);
+    if (resolved.IsImmediate() || resolved.GetInst()->GetOpcode() != opcode) {
+        return nullptr;
+    }
+    return resolved.GetInst();
+}
+
+struct AddWithCarryResult {
+    u64 result;
+    bool carry;
+    bool overflow;
+};
+
+AddWithCarryResult AddWithCarry(u64 a, u64 b, bool carry_in, bool is_32_bit) {
+    const u64 mask = is_32_bit ? 0xFFFFFFFF : 0xFFFFFFFFFFFFFFFF;
+    const size_t msb = is_32_bit ? 31 : 63;
+    a &= mask;
+    b &= mask;
+
+    const u64 partial = (a + b) & mask;
+    const u64 result = (partial + (carry_in ? 1 : 0)) & mask;
+    const bool carry = partial < a || (carry_in && result == 0);
+    const bool overflow = Common::Bit(msb, (a ^ result) & (b ^ result));
+    return {result, carry, overflow};
+}
+
+// Folds ADD and SUB operations based on the following:
+//
+// 1. imm_x + imm_y + carry -> result (along with any carry and overflow pseudo-operations)
+// 2. imm_x + y -> y + imm_x
+// 3. x + 0 -> x, x - 0 -> x
+// 4. x - x -> 0
+// 5. (x + imm_x) + imm_y -> x + (imm_x + imm_y) (likewise for subtraction)
+//
+void FoldAddSub(IR::Inst& inst, bool is_32_bit, bool is_sub) {
+    IR::Inst* carry_inst = inst.GetAssociatedPseudoOperation(IR::Opcode::GetCarryFromOp);
+    IR::Inst* overflow_inst = inst.GetAssociatedPseudoOperation(IR::Opcode::GetOverflowFromOp);
+    IR::Inst* nzcv_inst = inst.GetAssociatedPseudoOperation(IR::Opcode::GetNZCVFromOp);
+
+    if (!is_sub && inst.GetArg(0).IsImmediate() && !inst.GetArg(1).IsImmediate()) {
+        const IR::Value immediate = inst.GetArg(0);
+        inst.SetArg(0, inst.GetArg(1));
+        inst.SetArg(1, immediate);
+    }
+
+    const auto lhs = inst.GetArg(0);
+    const auto rhs = inst.GetArg(1);
+    const auto carry_in = inst.GetArg(2);
+
+    if (!carry_in.IsImmediate()) {
+        return;
+    }
+
+    if (lhs.IsImmediate() && rhs.IsImmediate()) {
+        // There is no immediate form of the host flags produced by GetNZCVFromOp.
+        if (nzcv_inst) {
+            return;
+        }
+
+        const u64 operand = is_sub ? ~rhs.GetImmediateAsU64() : rhs.GetImmediateAsU64();
+        const auto result = AddWithCarry(lhs.GetImmediateAsU64(), operand, carry_in.GetU1(), is_32_bit);
+        if (carry_inst) {
+            carry_inst->ReplaceUsesWith(IR::Value{result.carry});
+        }
+        if (overflow_inst) {
+            overflow_inst->ReplaceUsesWith(IR::Value{result.overflow});
+        }
+        ReplaceUsesWith(inst, is_32_bit, result.result);
+        return;
+    }
+
+    if (carry_inst || overflow_inst || nzcv_inst) {
+        return;
+    }
+
+    if (!rhs.IsImmediate()) {
+        if (is_sub && carry_in.GetU1() && IsSameValue(lhs, rhs)) {
+            ReplaceUsesWith(inst, is_32_bit, 0);
+        }
+        return;
+    }
+
+    // Both ADD and SUB with an immediate operand compute base + offset.
+    const auto offset_of = [](bool subtract, u64 operand, bool carry) {
+        return (subtract ? ~operand : operand) + (carry ? 1 : 0);
+    };
+    IR::Value base = lhs;
+    u64 offset = offset_of(is_sub, rhs.GetImmediateAsU64(), carry_in.GetU1());
+    bool reassociated = false;
+
+    const IR::Value resolved_lhs = Resolve(lhs);
+    if (!resolved_lhs.IsImmediate()) {
+        const IR::Inst& inner = *resolved_lhs.GetInst();
+        const auto inner_opcode = inner.GetOpcode();
+        const bool inner_is_add = inner_opcode == (is_32_bit ? IR::Opcode::Add32 : IR::Opcode::Add64);
+        const bool inner_is_sub = inner_opcode == (is_32_bit ? IR::Opcode::Sub32 : IR::Opcode::Sub64);
+
+        if ((inner_is_add || inner_is_sub) && inner.GetArg(1).IsImmediate() && inner.GetArg(2).IsImmediate()) {
+            base = inner.GetArg(0);
+            offset += offset_of(inner_is_sub, inner.GetArg(1).GetImmediateAsU64(), inner.GetArg(2).GetU1());
+            reassociated = true;
+        }
+    }
+
+    if (is_32_bit) {
+        offset &= 0xFFFFFFFF;
+    }
+
+    if (offset == 0) {
+        inst.ReplaceUsesWith(base);
+    } else if (reassociated) {
+        inst.SetArg(0, base);
+        inst.SetArg(1, MakeImmediate(is_32_bit, is_sub ? 0 - offset : offset));
+        inst.SetArg(2, IR::Value{is_sub});
+    }
+}
+
 // Folds AND operations based on the following:
 //
 // 1. imm_x & imm_y -> result
@@ -30,6 +177,7 @@ void ReplaceUsesWith(IR::Inst& inst, bool is_32_bit, u64 value) {
 // 3. 0 & y -> 0
 // 4. x & y -> y (where x has all bits set to 1)
 // 5. x & y -> x (where y has all bits set to 1)
+// 6. x & x -> x
 //
 void FoldAND(IR::Inst& inst, bool is_32_bit) {
     const auto lhs = inst.GetArg(0);
@@ -47,9 +195,53 @@ void FoldAND(IR::Inst& inst, bool is_32_bit) {
         inst.ReplaceUsesWith(rhs);
     } else if (is_rhs_immediate && rhs.HasAllBitsSet()) {
         inst.ReplaceUsesWith(lhs);
+    } else if (IsSameValue(lhs, rhs)) {
+        inst.ReplaceUsesWith(lhs);
     }
 }
 
+// Folds bitfield extractions based on the following:
+//
+// 1. extract(imm, lsb, width) -> result
+//
+void FoldBitFieldExtract(IR::Inst& inst, bool is_32_bit, bool is_signed) {
+    if (!inst.AreAllArgsImmediates()) {
+        return;
+    }
+
+    const size_t bitsize = is_32_bit ? 32 : 64;
+    const size_t lsb = inst.GetArg(1).GetU8();
+    const size_t width = inst.GetArg(2).GetU8();
+    const u64 value = inst.GetArg(0).GetImmediateAsU64() << (64 - lsb - width);
+    const u64 result = is_signed ? static_cast<u64>(static_cast<s64>(value) >> (64 - width)) : value >> (64 - width);
+    ReplaceUsesWith(inst, is_32_bit, result & Common::Ones<u64>(bitsize));
+}
+
+// Folds bitfield insertions based on the following:
+//
+// 1. insert(x, y, 0, bitsize) -> y
+// 2. insert(imm_x, imm_y, lsb, width) -> result
+//
+void FoldBitFieldInsert(IR::Inst& inst, bool is_32_bit) {
+    const size_t bitsize = is_32_bit ? 32 : 64;
+    const size_t lsb = inst.GetArg(2).GetU8();
+    const size_t width = inst.GetArg(3).GetU8();
+
+    if (width == bitsize) {
+        inst.ReplaceUsesWith(inst.GetArg(1));
+        return;
+    }
+
+    if (!inst.AreAllArgsImmediates()) {
+        return;
+    }
+
+    const u64 mask = Common::Ones<u64>(width) << lsb;
+    const u64 dst = inst.GetArg(0).GetImmediateAsU64();
+    const u64 src = inst.GetArg(1).GetImmediateAsU64();
+    ReplaceUsesWith(inst, is_32_bit, (dst & ~mask) | ((src << lsb) & mask));
+}
+
 // Folds byte reversal opcodes based on the following:
 //
 // 1. imm -> swap(imm)
@@ -73,6 +265,19 @@ void FoldByteReverse(IR::Inst& inst, IR::Opcode op) {
     }
 }
 
+// Folds conditional selects based on the following:
+//
+// 1. select(AL or NV, x, y) -> x
+// 2. select(cond, x, x) -> x
+//
+void FoldConditionalSelect(IR::Inst& inst) {
+    const auto cond = inst.GetArg(0).GetCond();
+
+    if (cond == IR::Cond::AL || cond == IR::Cond::NV || IsSameValue(inst.GetArg(1), inst.GetArg(2))) {
+        inst.ReplaceUsesWith(inst.GetArg(1));
+    }
+}
+
 // Folds division operations based on the following:
 //
 // 1. x / 0 -> 0 (NOTE: This is an ARM-specific behavior defined in the architecture reference manual)
@@ -106,6 +311,7 @@ void FoldDivide(IR::Inst& inst, bool is_32_bit, bool is_signed) {
 // 1. imm_x ^ imm_y -> result
 // 2. x ^ 0 -> x
 // 3. 0 ^ y -> y
+// 4. x ^ x -> 0
 //
 void FoldEOR(IR::Inst& inst, bool is_32_bit) {
     const auto lhs = inst.GetArg(0);
@@ -118,7 +324,32 @@ void FoldEOR(IR::Inst& inst, bool is_32_bit) {
         inst.ReplaceUsesWith(rhs);
     } else if (rhs.IsZero()) {
         inst.ReplaceUsesWith(lhs);
+    } else if (IsSameValue(lhs, rhs)) {
+        ReplaceUsesWith(inst, is_32_bit, 0);
+    }
+}
+
+// Folds EXTR operations based on the following:
+//
+// 1. extract(x, y, 0) -> x
+// 2. extract(imm_x, imm_y, lsb) -> result
+//
+void FoldExtractRegister(IR::Inst& inst, bool is_32_bit) {
+    const size_t lsb = inst.GetArg(2).GetU8();
+
+    if (lsb == 0) {
+        inst.ReplaceUsesWith(inst.GetArg(0));
+        return;
+    }
+
+    if (!inst.AreAllArgsImmediates()) {
+        return;
     }
+
+    const size_t bitsize = is_32_bit ? 32 : 64;
+    const u64 lower = inst.GetArg(0).GetImmediateAsU64();
+    const u64 upper = inst.GetArg(1).GetImmediateAsU64();
+    ReplaceUsesWith(inst, is_32_bit, (lower >> lsb) | (upper << (bitsize - lsb)));
 }
 
 void FoldLeastSignificantByte(IR::Inst& inst) {
@@ -212,6 +443,7 @@ void FoldNOT(IR::Inst& inst, bool is_32_bit) {
 // 1. imm_x | imm_y -> result
 // 2. x | 0 -> x
 // 3. 0 | y -> y
+// 4. x | x -> x
 //
 void FoldOR(IR::Inst& inst, bool is_32_bit) {
     const auto lhs = inst.GetArg(0);
@@ -224,6 +456,8 @@ void FoldOR(IR::Inst& inst, bool is_32_bit) {
         inst.ReplaceUsesWith(rhs);
     } else if (rhs.IsZero()) {
         inst.ReplaceUsesWith(lhs);
+    } else if (IsSameValue(lhs, rhs)) {
+        inst.ReplaceUsesWith(lhs);
     }
 }
 
@@ -282,6 +516,249 @@ void FoldZeroExtendXToLong(IR::Inst& inst) {
     const u64 value = inst.GetArg(0).GetImmediateAsU64();
     inst.ReplaceUsesWith(IR::Value{value});
 }
+// 128-bit constants are not IR immediates, but are recognised from the instructions that build them.
+using VectorConstant = std::array<u64, 2>;
+
+std::optional<VectorConstant> GetVectorConstant(const IR::Value& value) {
+    const IR::Value resolved = Resolve(value);
+    if (resolved.IsImmediate()) {
+        return std::nullopt;
+    }
+
+    const IR::Inst& inst = *resolved.GetInst();
+    const auto broadcast = [&inst](size_t esize) -> std::optional<VectorConstant> {
+        if (!inst.GetArg(0).IsImmediate()) {
+            return std::nullopt;
+        }
+        const u64 element = Common::Replicate(inst.GetArg(0).GetImmediateAsU64(), esize);
+        return VectorConstant{element, element};
+    };
+
+    switch (inst.GetOpcode()) {
+    case IR::Opcode::ZeroVector:
+        return VectorConstant{0, 0};
+    case IR::Opcode::ZeroExtendLongToQuad:
+        if (!inst.GetArg(0).IsImmediate()) {
+            return std::nullopt;
+        }
+        return VectorConstant{inst.GetArg(0).GetImmediateAsU64(), 0};
+    case IR::Opcode::VectorBroadcast8:
+        return broadcast(8);
+    case IR::Opcode::VectorBroadcast16:
+        return broadcast(16);
+    case IR::Opcode::VectorBroadcast32:
+        return broadcast(32);
+    case IR::Opcode::VectorBroadcast64:
+        return broadcast(64);
+    default:
+        return std::nullopt;
+    }
+}
+
+bool IsZeroVector(const IR::Value& value) {
+    const auto constant = GetVectorConstant(value);
+    return constant && (*constant)[0] == 0 && (*constant)[1] == 0;
+}
+
+bool IsOnesVector(const IR::Value& value) {
+    const auto constant = GetVectorConstant(value);
+    return constant && (*constant)[0] == ~u64(0) && (*constant)[1] == ~u64(0);
+}
+
+// Replaces the uses of inst with a newly built constant inserted immediately before it.
+void ReplaceUsesWithVectorConstant(IR::Block& block, IR::Inst& inst, const VectorConstant& constant) {
+    IR::IREmitter ir{block};
+    ir.SetInsertionPoint(&inst);
+
+    const auto [lower, upper] = constant;
+    if (lower == 0 && upper == 0) {
+        inst.ReplaceUsesWith(ir.ZeroVector());
+    } else if (upper == 0) {
+        inst.ReplaceUsesWith(ir.ZeroExtendToQuad(ir.Imm64(lower)));
+    } else if (lower == upper) {
+        inst.ReplaceUsesWith(ir.VectorBroadcast(64, ir.Imm64(lower)));
+    } else {
+        inst.ReplaceUsesWith(ir.VectorSetElement(64, ir.ZeroExtendToQuad(ir.Imm64(lower)), 1, ir.Imm64(upper)));
+    }
+}
+
+// Folds vector AND, OR and EOR operations based on the following:
+//
+// 1. const_x op const_y -> result
+// 2. x & 0 -> 0, x & ~0 -> x
+// 3. x | 0 -> x, x | ~0 -> ~0
+// 4. x ^ 0 -> x
+// 5. x & x -> x, x | x -> x, x ^ x -> 0
+//
+void FoldVectorBitwise(IR::Block& block, IR::Inst& inst, IR::Opcode op) {
+    const auto lhs = inst.GetArg(0);
+    const auto rhs = inst.GetArg(1);
+    const auto lhs_constant = GetVectorConstant(lhs);
+    const auto rhs_constant = GetVectorConstant(rhs);
+    const bool is_and = op == IR::Opcode::VectorAnd;
+    const bool is_or = op == IR::Opcode::VectorOr;
+
+    if (lhs_constant && rhs_constant) {
+        VectorConstant result;
+        for (size_t i = 0; i < result.size(); i++) {
+            const u64 a = (*lhs_constant)[i];
+            const u64 b = (*rhs_constant)[i];
+            result[i] = is_and ? a & b : is_or ? a | b : a ^ b;
+        }
+        ReplaceUsesWithVectorConstant(block, inst, result);
+        return;
+    }
+
+    const auto is_absorbing = [&](const IR::Value& value) {
+        return (is_and && IsZeroVector(value)) || (is_or && IsOnesVector(value));
+    };
+    const auto is_identity = [&](const IR::Value& value) {
+        return is_and ? IsOnesVector(value) : IsZeroVector(value);
+    };
+
+    if (is_absorbing(lhs) || is_identity(rhs)) {
+        inst.ReplaceUsesWith(lhs);
+    } else if (is_absorbing(rhs) || is_identity(lhs)) {
+        inst.ReplaceUsesWith(rhs);
+    } else if (IsSameValue(lhs, rhs)) {
+        if (is_and || is_or) {
+            inst.ReplaceUsesWith(lhs);
+        } else {
+            ReplaceUsesWithVectorConstant(block, inst, {0, 0});
+        }
+    }
+}
+
+// Folds vector NOT operations if the operand is a constant.
+void FoldVectorNot(IR::Block& block, IR::Inst& inst) {
+    const auto operand = GetVectorConstant(inst.GetArg(0));
+    if (!operand) {
+        return;
+    }
+
+    ReplaceUsesWithVectorConstant(block, inst, {~(*operand)[0], ~(*operand)[1]});
+}
+
+// Folds lane-wise vector ADD and SUB operations based on the following:
+//
+// 1. const_x op const_y -> result
+// 2. x + 0 -> x, 0 + y -> y, x - 0 -> x
+// 3. x - x -> 0
+//
+void FoldVectorAddSub(IR::Block& block, IR::Inst& inst, size_t esize, bool is_sub) {
+    const auto lhs = inst.GetArg(0);
+    const auto rhs = inst.GetArg(1);
+    const auto lhs_constant = GetVectorConstant(lhs);
+    const auto rhs_constant = GetVectorConstant(rhs);
+
+    if (lhs_constant && rhs_constant) {
+        const u64 mask = esize == 64 ? ~u64(0) : (u64(1) << esize) - 1;
+        VectorConstant result{};
+        for (size_t i = 0; i < result.size(); i++) {
+            for (size_t shift = 0; shift < 64; shift += esize) {
+                const u64 a = ((*lhs_constant)[i] >> shift) & mask;
+                const u64 b = ((*rhs_constant)[i] >> shift) & mask;
+                result[i] |= ((is_sub ? a - b : a + b) & mask) << shift;
+            }
+        }
+        ReplaceUsesWithVectorConstant(block, inst, result);
+    } else if (IsZeroVector(rhs)) {
+        inst.ReplaceUsesWith(lhs);
+    } else if (!is_sub && IsZeroVector(lhs)) {
+        inst.ReplaceUsesWith(rhs);
+    } else if (is_sub && IsSameValue(lhs, rhs)) {
+        ReplaceUsesWithVectorConstant(block, inst, {0, 0});
+    }
+}
+
+// Folds element extraction based on the following:
+//
+// 1. get_element(const, index) -> imm
+// 2. get_element(broadcast(x), index) -> x
+// 3. get_element64(zero_extend_to_quad(x), 0) -> x
+//
+void FoldVectorGetElement(IR::Inst& inst, size_t esize) {
+    const auto vector = inst.GetArg(0);
+    const size_t index = inst.GetArg(1).GetU8();
+
+    if (const auto constant = GetVectorConstant(vector)) {
+        const size_t bit = index * esize;
+        const u64 element = (*constant)[bit / 64] >> (bit % 64);
+        switch (esize) {
+        case 8:
+            inst.ReplaceUsesWith(IR::Value{static_cast<u8>(element)});
+            break;
+        case 16:
+            inst.ReplaceUsesWith(IR::Value{static_cast<u16>(element)});
+            break;
+        case 32:
+            inst.ReplaceUsesWith(IR::Value{static_cast<u32>(element)});
+            break;
+        default:
+            inst.ReplaceUsesWith(IR::Value{element});
+            break;
+        }
+        return;
+    }
+
+    const IR::Opcode broadcast_opcode = [esize] {
+        switch (esize) {
+        case 8:
+            return IR::Opcode::VectorBroadcast8;
+        case 16:
+            return IR::Opcode::VectorBroadcast16;
+        case 32:
+            return IR::Opcode::VectorBroadcast32;
+        default:
+            return IR::Opcode::VectorBroadcast64;
+        }
+    }();
+    if (const IR::Inst* broadcast = GetProducer(vector, broadcast_opcode)) {
+        inst.ReplaceUsesWith(broadcast->GetArg(0));
+        return;
+    }
+
+    if (esize == 64 && index == 0) {
+        if (const IR::Inst* extend = GetProducer(vector, IR::Opcode::ZeroExtendLongToQuad)) {
+            inst.ReplaceUsesWith(extend->GetArg(0));
+        }
+    }
+}
+
+// Folds VectorZeroUpper when the upper half of its operand is known.
+void FoldVectorZeroUpper(IR::Block& block, IR::Inst& inst) {
+    const auto operand = inst.GetArg(0);
+
+    if (GetProducer(operand, IR::Opcode::ZeroExtendLongToQuad)) {
+        inst.ReplaceUsesWith(operand);
+    } else if (const auto constant = GetVectorConstant(operand)) {
+        ReplaceUsesWithVectorConstant(block, inst, {(*constant)[0], 0});
+    }
+}
+
+// Fuses an AES round with the MixColumns step that follows it based on the following:
+//
+// 1. mix_columns(encrypt_round(x)) -> encrypt_round_and_mix_columns(x)
+// 2. inverse_mix_columns(decrypt_round(x)) -> decrypt_round_and_inverse_mix_columns(x)
+//
+// This is only done when the round result has no other users, as it would otherwise still have to be computed.
+void FoldAESMixColumns(IR::Block& block, IR::Inst& inst, bool is_inverse) {
+    const IR::Opcode round_opcode = is_inverse ? IR::Opcode::AESDecryptSingleRound : IR::Opcode::AESEncryptSingleRound;
+    const IR::Inst* round = GetProducer(inst.GetArg(0), round_opcode);
+    if (!round || round->UseCount() != 1) {
+        return;
+    }
+
+    IR::IREmitter ir{block};
+    ir.SetInsertionPoint(&inst);
+
+    const IR::U128 operand{round->GetArg(0)};
+    if (is_inverse) {
+        inst.ReplaceUsesWith(ir.AESDecryptSingleRoundAndInverseMixColumns(operand));
+    } else {
+        inst.ReplaceUsesWith(ir.AESEncryptSingleRoundAndMixColumns(operand));
+    }
+}
 } // Anonymous namespace
 
 void ConstantPropagation(IR::Block& block) {
@@ -314,6 +791,14 @@ void ConstantPropagation(IR::Block& block) {
         case IR::Opcode::RotateRight64:
             FoldShifts(inst);
             break;
+        case IR::Opcode::Add32:
+        case IR::Opcode::Add64:
+            FoldAddSub(inst, opcode == IR::Opcode::Add32, false);
+            break;
+        case IR::Opcode::Sub32:
+        case IR::Opcode::Sub64:
+            FoldAddSub(inst, opcode == IR::Opcode::Sub32, true);
+            break;
         case IR::Opcode::Mul32:
         case IR::Opcode::Mul64:
             FoldMultiply(inst, opcode == IR::Opcode::Mul32);
@@ -365,6 +850,80 @@ void ConstantPropagation(IR::Block& block) {
         case IR::Opcode::ByteReverseDual:
             FoldByteReverse(inst, opcode);
             break;
+        case IR::Opcode::ExtractRegister32:
+        case IR::Opcode::ExtractRegister64:
+            FoldExtractRegister(inst, opcode == IR::Opcode::ExtractRegister32);
+            break;
+        case IR::Opcode::UnsignedBitFieldExtract32:
+        case IR::Opcode::UnsignedBitFieldExtract64:
+            FoldBitFieldExtract(inst, opcode == IR::Opcode::UnsignedBitFieldExtract32, false);
+            break;
+        case IR::Opcode::SignedBitFieldExtract32:
+        case IR::Opcode::SignedBitFieldExtract64:
+            FoldBitFieldExtract(inst, opcode == IR::Opcode::SignedBitFieldExtract32, true);
+            break;
+        case IR::Opcode::BitFieldInsert32:
+        case IR::Opcode::BitFieldInsert64:
+            FoldBitFieldInsert(inst, opcode == IR::Opcode::BitFieldInsert32);
+            break;
+        case IR::Opcode::ConditionalSelect32:
+        case IR::Opcode::ConditionalSelect64:
+        case IR::Opcode::ConditionalSelectNZCV:
+            FoldConditionalSelect(inst);
+            break;
+        case IR::Opcode::VectorAnd:
+        case IR::Opcode::VectorOr:
+        case IR::Opcode::VectorEor:
+            FoldVectorBitwise(block, inst, opcode);
+            break;
+        case IR::Opcode::VectorNot:
+            FoldVectorNot(block, inst);
+            break;
+        case IR::Opcode::VectorAdd8:
+            FoldVectorAddSub(block, inst, 8, false);
+            break;
+        case IR::Opcode::VectorAdd16:
+            FoldVectorAddSub(block, inst, 16, false);
+            break;
+        case IR::Opcode::VectorAdd32:
+            FoldVectorAddSub(block, inst, 32, false);
+            break;
+        case IR::Opcode::VectorAdd64:
+            FoldVectorAddSub(block, inst, 64, false);
+            break;
+        case IR::Opcode::VectorSub8:
+            FoldVectorAddSub(block, inst, 8, true);
+            break;
+        case IR::Opcode::VectorSub16:
+            FoldVectorAddSub(block, inst, 16, true);
+            break;
+        case IR::Opcode::VectorSub32:
+            FoldVectorAddSub(block, inst, 32, true);
+            break;
+        case IR::Opcode::VectorSub64:
+            FoldVectorAddSub(block, inst, 64, true);
+            break;
+        case IR::Opcode::VectorGetElement8:
+            FoldVectorGetElement(inst, 8);
+            break;
+        case IR::Opcode::VectorGetElement16:
+            FoldVectorGetElement(inst, 16);
+            break;
+        case IR::Opcode::VectorGetElement32:
+            FoldVectorGetElement(inst, 32);
+            break;
+        case IR::Opcode::VectorGetElement64:
+            FoldVectorGetElement(inst, 64);
+            break;
+        case IR::Opcode::VectorZeroUpper:
+            FoldVectorZeroUpper(block, inst);
+            break;
+        case IR::Opcode::AESInverseMixColumns:
+            FoldAESMixColumns(block, inst, true);
+            break;
+        case IR::Opcode::AESMixColumns:
+            FoldAESMixColumns(block, inst, false);
+            break;
         default:
             break;
         }
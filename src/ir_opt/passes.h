@@ -23,11 +23,19 @@ namespace Dynarmic::Optimization {
 
 void A32GetSetElimination(IR::Block& block);
 void A32ConstantMemoryReads(IR::Block& block, A32::UserCallbacks* cb);
+void A64AddressModeFolding(IR::Block& block);
 void A64CallbackConfigPass(IR::Block& block, const A64::UserConfig& conf);
+void A64ConstantMemoryReads(IR::Block& block, A64::UserCallbacks* cb);
+void A64FlagLiveness(IR::Block& block);
 void A64GetSetElimination(IR::Block& block);
+void A64MemoryPairMerging(IR::Block& block);
 void A64MergeInterpretBlocksPass(IR::Block& block, A64::UserCallbacks* cb);
+void A64PageLookupReuse(IR::Block& block, const A64::UserConfig& conf);
+void CommonSubexpressionElimination(IR::Block& block);
 void ConstantPropagation(IR::Block& block);
 void DeadCodeElimination(IR::Block& block);
+void RedundantExtensionElimination(IR::Block& block);
+void RedundantLoadStoreElimination(IR::Block& block);
 void VerificationPass(const IR::Block& block);
 
 } // namespace Dynarmic::Optimization
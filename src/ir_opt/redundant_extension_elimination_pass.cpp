@@ -0,0 +1,380 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include <algorithm>
+#include <optional>
+#include <unordered_map>
+
+#include "common/common_types.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+#include "frontend/ir/value.h"
+#include "ir_opt/passes.h"
+
+namespace Dynarmic::Optimization {
+namespace {
+
+/// Bits of a value that are known to be zero or known to be one. Bits above the width of the value are ignored.
+struct KnownBits {
+    u64 zeros = 0;
+    u64 ones = 0;
+};
+
+size_t BitWidth(IR::Type type) {
+    switch (type) {
+    case IR::Type::U1:
+        return 1;
+    case IR::Type::U8:
+        return 8;
+    case IR::Type::U16:
+        return 16;
+    case IR::Type::U32:
+        return 32;
+    case IR::Type::U64:
+        return 64;
+    default:
+        return 0;
+    }
+}
+
+constexpr u64 WidthMask(size_t width) {
+    return width >= 64 ? ~u64(0) : (u64(1) << width) - 1;
+}
+
+/// Are all bits from bit `lsb` up to the top of a `width`-bit value known to be equal to each other?
+bool AreUpperBitsUniform(const KnownBits& known, size_t lsb, size_t width) {
+    const u64 mask = WidthMask(width) & ~WidthMask(lsb);
+    return (known.zeros & mask) == mask || (known.ones & mask) == mask;
+}
+
+IR::Value ResolveIdentity(IR::Value value) {
+    while (!value.IsImmediate() && value.GetInst()->GetOpcode() == IR::Opcode::Identity) {
+        value = value.GetInst()->GetArg(0);
+    }
+    return value;
+}
+
+class KnownBitsAnalysis {
+public:
+    KnownBits Get(IR::Value value) const {
+        value = ResolveIdentity(value);
+        if (value.IsImmediate()) {
+            const size_t width = BitWidth(value.GetType());
+            if (width == 0) {
+                return {};
+            }
+            const u64 imm = value.GetImmediateAsU64() & WidthMask(width);
+            return {~imm & WidthMask(width), imm};
+        }
+
+        const auto iter = known.find(value.GetInst());
+        return iter != known.end() ? iter->second : KnownBits{};
+    }
+
+    void Record(const IR::Inst& inst, KnownBits bits) {
+        known[&inst] = bits;
+    }
+
+private:
+    std::unordered_map<const IR::Inst*, KnownBits> known;
+};
+
+KnownBits ZeroExtend(const KnownBits& src, size_t src_width, size_t dest_width) {
+    const u64 upper = WidthMask(dest_width) & ~WidthMask(src_width);
+    return {src.zeros | upper, src.ones};
+}
+
+KnownBits SignExtend(const KnownBits& src, size_t src_width, size_t dest_width) {
+    const u64 upper = WidthMask(dest_width) & ~WidthMask(src_width);
+    const u64 sign_bit = u64(1) << (src_width - 1);
+
+    KnownBits result = src;
+    if (src.zeros & sign_bit) {
+        result.zeros |= upper;
+    } else if (src.ones & sign_bit) {
+        result.ones |= upper;
+    }
+    return result;
+}
+
+KnownBits Truncate(const KnownBits& src, size_t width) {
+    return {src.zeros & WidthMask(width), src.ones & WidthMask(width)};
+}
+
+KnownBits ShiftLeft(const KnownBits& src, const IR::Value& shift, size_t width) {
+    if (!shift.IsImmediate()) {
+        return {};
+    }
+
+    const size_t amount = shift.GetU8();
+    if (amount >= width) {
+        return {WidthMask(width), 0};
+    }
+    return {((src.zeros << amount) | WidthMask(amount)) & WidthMask(width), (src.ones << amount) & WidthMask(width)};
+}
+
+KnownBits ShiftRight(const KnownBits& src, const IR::Value& shift, size_t width) {
+    if (!shift.IsImmediate()) {
+        return {};
+    }
+
+    const size_t amount = shift.GetU8();
+    if (amount >= width) {
+        return {WidthMask(width), 0};
+    }
+    const u64 vacated = WidthMask(width) & ~WidthMask(width - amount);
+    return {(src.zeros >> amount) | vacated, src.ones >> amount};
+}
+
+KnownBits ArithmeticShiftRight(const KnownBits& src, const IR::Value& shift, size_t width) {
+    if (!shift.IsImmediate()) {
+        return {};
+    }
+
+    const size_t amount = std::min<size_t>(shift.GetU8(), width - 1);
+    const KnownBits shifted = ShiftRight(src, IR::Value{static_cast<u8>(amount)}, width);
+    const u64 sign_bit = u64(1) << (width - 1);
+    const u64 vacated = WidthMask(width) & ~WidthMask(width - amount);
+
+    if (src.zeros & sign_bit) {
+        return shifted;
+    }
+    if (src.ones & sign_bit) {
+        return {shifted.zeros & ~vacated, shifted.ones | vacated};
+    }
+    return {shifted.zeros & ~vacated, shifted.ones};
+}
+
+KnownBits RotateRight(const KnownBits& src, const IR::Value& shift, size_t width) {
+    if (!shift.IsImmediate()) {
+        return {};
+    }
+
+    const size_t amount = shift.GetU8() % width;
+    const auto rotate = [&](u64 bits) {
+        return amount == 0 ? bits : ((bits >> amount) | (bits << (width - amount))) & WidthMask(width);
+    };
+    return {rotate(src.zeros), rotate(src.ones)};
+}
+
+/// A bitfield extract is equivalent to shifting the field to the top of the value and then back down.
+KnownBits BitFieldExtract(const KnownBits& src, const IR::Value& lsb, const IR::Value& field_width, size_t width, bool is_signed) {
+    if (!lsb.IsImmediate() || !field_width.IsImmediate()) {
+        return {};
+    }
+
+    const KnownBits shifted = ShiftLeft(src, IR::Value{static_cast<u8>(width - lsb.GetU8() - field_width.GetU8())}, width);
+    const IR::Value shift_down{static_cast<u8>(width - field_width.GetU8())};
+    return is_signed ? ArithmeticShiftRight(shifted, shift_down, width) : ShiftRight(shifted, shift_down, width);
+}
+
+KnownBits BitFieldInsert(const KnownBits& dst, const KnownBits& src, const IR::Value& lsb, const IR::Value& field_width, size_t width) {
+    if (!lsb.IsImmediate() || !field_width.IsImmediate()) {
+        return {};
+    }
+
+    const u64 field_mask = WidthMask(field_width.GetU8()) << lsb.GetU8();
+    const KnownBits field = ShiftLeft(src, lsb, width);
+    return {(dst.zeros & ~field_mask) | (field.zeros & field_mask), (dst.ones & ~field_mask) | (field.ones & field_mask)};
+}
+
+KnownBits Compute(const KnownBitsAnalysis& analysis, const IR::Inst& inst) {
+    const auto arg = [&](size_t index) { return analysis.Get(inst.GetArg(index)); };
+
+    switch (inst.GetOpcode()) {
+    case IR::Opcode::ZeroExtendByteToWord:
+        return ZeroExtend(arg(0), 8, 32);
+    case IR::Opcode::ZeroExtendHalfToWord:
+        return ZeroExtend(arg(0), 16, 32);
+    case IR::Opcode::ZeroExtendByteToLong:
+        return ZeroExtend(arg(0), 8, 64);
+    case IR::Opcode::ZeroExtendHalfToLong:
+        return ZeroExtend(arg(0), 16, 64);
+    case IR::Opcode::ZeroExtendWordToLong:
+        return ZeroExtend(arg(0), 32, 64);
+    case IR::Opcode::SignExtendByteToWord:
+        return SignExtend(arg(0), 8, 32);
+    case IR::Opcode::SignExtendHalfToWord:
+        return SignExtend(arg(0), 16, 32);
+    case IR::Opcode::SignExtendByteToLong:
+        return SignExtend(arg(0), 8, 64);
+    case IR::Opcode::SignExtendHalfToLong:
+        return SignExtend(arg(0), 16, 64);
+    case IR::Opcode::SignExtendWordToLong:
+        return SignExtend(arg(0), 32, 64);
+    case IR::Opcode::LeastSignificantByte:
+        return Truncate(arg(0), 8);
+    case IR::Opcode::LeastSignificantHalf:
+        return Truncate(arg(0), 16);
+    case IR::Opcode::LeastSignificantWord:
+        return Truncate(arg(0), 32);
+    case IR::Opcode::MostSignificantWord: {
+        const KnownBits src = arg(0);
+        return {src.zeros >> 32, src.ones >> 32};
+    }
+    case IR::Opcode::And32:
+    case IR::Opcode::And64: {
+        const KnownBits a = arg(0);
+        const KnownBits b = arg(1);
+        return {a.zeros | b.zeros, a.ones & b.ones};
+    }
+    case IR::Opcode::Or32:
+    case IR::Opcode::Or64: {
+        const KnownBits a = arg(0);
+        const KnownBits b = arg(1);
+        return {a.zeros & b.zeros, a.ones | b.ones};
+    }
+    case IR::Opcode::Eor32:
+    case IR::Opcode::Eor64: {
+        const KnownBits a = arg(0);
+        const KnownBits b = arg(1);
+        return {(a.zeros & b.zeros) | (a.ones & b.ones), (a.zeros & b.ones) | (a.ones & b.zeros)};
+    }
+    case IR::Opcode::Not32:
+    case IR::Opcode::Not64: {
+        const KnownBits a = arg(0);
+        return {a.ones, a.zeros};
+    }
+    case IR::Opcode::LogicalShiftLeft32:
+        return ShiftLeft(arg(0), inst.GetArg(1), 32);
+    case IR::Opcode::LogicalShiftLeft64:
+        return ShiftLeft(arg(0), inst.GetArg(1), 64);
+    case IR::Opcode::LogicalShiftRight32:
+        return ShiftRight(arg(0), inst.GetArg(1), 32);
+    case IR::Opcode::LogicalShiftRight64:
+        return ShiftRight(arg(0), inst.GetArg(1), 64);
+    case IR::Opcode::ArithmeticShiftRight32:
+        return ArithmeticShiftRight(arg(0), inst.GetArg(1), 32);
+    case IR::Opcode::ArithmeticShiftRight64:
+        return ArithmeticShiftRight(arg(0), inst.GetArg(1), 64);
+    case IR::Opcode::RotateRight32:
+        return RotateRight(arg(0), inst.GetArg(1), 32);
+    case IR::Opcode::RotateRight64:
+        return RotateRight(arg(0), inst.GetArg(1), 64);
+    case IR::Opcode::UnsignedBitFieldExtract32:
+        return BitFieldExtract(arg(0), inst.GetArg(1), inst.GetArg(2), 32, false);
+    case IR::Opcode::UnsignedBitFieldExtract64:
+        return BitFieldExtract(arg(0), inst.GetArg(1), inst.GetArg(2), 64, false);
+    case IR::Opcode::SignedBitFieldExtract32:
+        return BitFieldExtract(arg(0), inst.GetArg(1), inst.GetArg(2), 32, true);
+    case IR::Opcode::SignedBitFieldExtract64:
+        return BitFieldExtract(arg(0), inst.GetArg(1), inst.GetArg(2), 64, true);
+    case IR::Opcode::BitFieldInsert32:
+        return BitFieldInsert(arg(0), arg(1), inst.GetArg(2), inst.GetArg(3), 32);
+    case IR::Opcode::BitFieldInsert64:
+        return BitFieldInsert(arg(0), arg(1), inst.GetArg(2), inst.GetArg(3), 64);
+    default:
+        return {};
+    }
+}
+
+/// If `value` is the truncation of a value of type `type`, returns that wider value.
+std::optional<IR::Value> GetTruncatedValue(IR::Value value, IR::Opcode truncation, IR::Type type) {
+    value = ResolveIdentity(value);
+    if (value.IsImmediate() || value.GetInst()->GetOpcode() != truncation) {
+        return std::nullopt;
+    }
+
+    const IR::Value wide = value.GetInst()->GetArg(0);
+    if (wide.GetType() != type) {
+        return std::nullopt;
+    }
+    return wide;
+}
+
+IR::Opcode TruncationFor(IR::Opcode extension) {
+    switch (extension) {
+    case IR::Opcode::ZeroExtendByteToWord:
+    case IR::Opcode::SignExtendByteToWord:
+        return IR::Opcode::LeastSignificantByte;
+    case IR::Opcode::ZeroExtendHalfToWord:
+    case IR::Opcode::SignExtendHalfToWord:
+        return IR::Opcode::LeastSignificantHalf;
+    case IR::Opcode::ZeroExtendWordToLong:
+    case IR::Opcode::SignExtendWordToLong:
+        return IR::Opcode::LeastSignificantWord;
+    default:
+        return IR::Opcode::Void;
+    }
+}
+
+bool IsZeroExtension(IR::Opcode op) {
+    return op == IR::Opcode::ZeroExtendByteToWord
+        || op == IR::Opcode::ZeroExtendHalfToWord
+        || op == IR::Opcode::ZeroExtendWordToLong;
+}
+
+// Removes an extension of a truncated value back to its original width, if the truncated-away
+// bits are already known to hold the zeros (or copies of the sign bit) that the extension would produce.
+bool RemoveRedundantExtension(const KnownBitsAnalysis& analysis, IR::Inst& inst) {
+    const IR::Opcode truncation = TruncationFor(inst.GetOpcode());
+    if (truncation == IR::Opcode::Void) {
+        return false;
+    }
+
+    const auto wide = GetTruncatedValue(inst.GetArg(0), truncation, inst.GetType());
+    if (!wide) {
+        return false;
+    }
+
+    const size_t width = BitWidth(inst.GetType());
+    const size_t narrow_width = BitWidth(inst.GetArg(0).GetType());
+    const KnownBits known = analysis.Get(*wide);
+
+    const bool redundant = IsZeroExtension(inst.GetOpcode())
+                         ? (known.zeros | WidthMask(narrow_width)) == WidthMask(width)
+                         : AreUpperBitsUniform(known, narrow_width - 1, width);
+    if (!redundant) {
+        return false;
+    }
+
+    inst.ReplaceUsesWith(*wide);
+    return true;
+}
+
+// Removes an AND whose mask only clears bits that are already known to be zero,
+// and an OR that only sets bits that are already known to be one.
+bool RemoveRedundantMask(const KnownBitsAnalysis& analysis, IR::Inst& inst) {
+    const bool is_and = inst.GetOpcode() == IR::Opcode::And32 || inst.GetOpcode() == IR::Opcode::And64;
+    const bool is_or = inst.GetOpcode() == IR::Opcode::Or32 || inst.GetOpcode() == IR::Opcode::Or64;
+    if ((!is_and && !is_or) || inst.HasAssociatedPseudoOperation()) {
+        return false;
+    }
+
+    const u64 mask = WidthMask(BitWidth(inst.GetType()));
+    for (size_t i = 0; i < 2; i++) {
+        const KnownBits value = analysis.Get(inst.GetArg(i));
+        const KnownBits other = analysis.Get(inst.GetArg(1 - i));
+
+        // Every bit of `other` must leave the corresponding bit of `value` unchanged.
+        const bool unchanged = is_and
+                             ? ((other.ones | value.zeros) & mask) == mask
+                             : ((other.zeros | value.ones) & mask) == mask;
+        if (unchanged) {
+            inst.ReplaceUsesWith(inst.GetArg(i));
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // Anonymous namespace
+
+void RedundantExtensionElimination(IR::Block& block) {
+    KnownBitsAnalysis analysis;
+
+    for (auto& inst : block) {
+        if (RemoveRedundantExtension(analysis, inst) || RemoveRedundantMask(analysis, inst)) {
+            continue;
+        }
+
+        analysis.Record(inst, Compute(analysis, inst));
+    }
+}
+
+} // namespace Dynarmic::Optimization
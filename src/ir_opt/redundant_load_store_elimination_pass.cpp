@@ -0,0 +1,234 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+#include "common/common_types.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+#include "frontend/ir/value.h"
+#include "ir_opt/passes.h"
+
+namespace Dynarmic::Optimization {
+namespace {
+
+/// An address expressed as a base instruction (nullptr for an absolute address) plus a constant offset.
+struct Address {
+    IR::Inst* base;
+    u64 offset;
+    u64 mask;
+};
+
+struct MemoryAccess {
+    Address address;
+    size_t bytes;
+};
+
+/// The contents of a range of memory known at some point within the block.
+struct KnownValue {
+    MemoryAccess access;
+    IR::Value value;
+};
+
+IR::Value ResolveIdentity(IR::Value value) {
+    while (!value.IsImmediate() && value.GetInst()->GetOpcode() == IR::Opcode::Identity) {
+        value = value.GetInst()->GetArg(0);
+    }
+    return value;
+}
+
+Address DecomposeAddress(IR::Value value, u64 mask) {
+    value = ResolveIdentity(value);
+    if (value.IsImmediate()) {
+        return {nullptr, value.GetImmediateAsU64() & mask, mask};
+    }
+
+    IR::Inst* const inst = value.GetInst();
+    switch (inst->GetOpcode()) {
+    case IR::Opcode::Add32:
+    case IR::Opcode::Add64:
+    case IR::Opcode::Sub32:
+    case IR::Opcode::Sub64: {
+        const bool is_add = inst->GetOpcode() == IR::Opcode::Add32 || inst->GetOpcode() == IR::Opcode::Add64;
+        const IR::Value base = ResolveIdentity(inst->GetArg(0));
+        const IR::Value offset = inst->GetArg(1);
+        const IR::Value carry = inst->GetArg(2);
+
+        if (base.IsImmediate() || !offset.IsImmediate() || !carry.IsImmediate() || carry.GetU1() != !is_add) {
+            break;
+        }
+        if (inst->HasAssociatedPseudoOperation()) {
+            break;
+        }
+
+        const u64 imm = offset.GetImmediateAsU64();
+        return {base.GetInst(), (is_add ? imm : 0 - imm) & mask, mask};
+    }
+    default:
+        break;
+    }
+
+    return {inst, 0, mask};
+}
+
+/// A64 memory accesses address base + (offset << shift).
+Address DecomposeA64Address(const IR::Inst& inst) {
+    constexpr u64 mask64 = ~u64(0);
+
+    const IR::Value offset = inst.GetArg(1);
+    if (!offset.IsImmediate()) {
+        // Register-indexed: the address is unrelated to any other.
+        return {const_cast<IR::Inst*>(&inst), 0, mask64};
+    }
+
+    Address address = DecomposeAddress(inst.GetArg(0), mask64);
+    address.offset += offset.GetU64() << inst.GetArg(2).GetU8();
+    return address;
+}
+
+std::optional<MemoryAccess> DecodeRead(const IR::Inst& inst) {
+    constexpr u64 mask32 = 0xFFFFFFFF;
+
+    switch (inst.GetOpcode()) {
+    case IR::Opcode::A32ReadMemory8:
+        return MemoryAccess{DecomposeAddress(inst.GetArg(0), mask32), 1};
+    case IR::Opcode::A32ReadMemory16:
+        return MemoryAccess{DecomposeAddress(inst.GetArg(0), mask32), 2};
+    case IR::Opcode::A32ReadMemory32:
+        return MemoryAccess{DecomposeAddress(inst.GetArg(0), mask32), 4};
+    case IR::Opcode::A32ReadMemory64:
+        return MemoryAccess{DecomposeAddress(inst.GetArg(0), mask32), 8};
+    case IR::Opcode::A64ReadMemory8:
+        return MemoryAccess{DecomposeA64Address(inst), 1};
+    case IR::Opcode::A64ReadMemory16:
+        return MemoryAccess{DecomposeA64Address(inst), 2};
+    case IR::Opcode::A64ReadMemory32:
+        return MemoryAccess{DecomposeA64Address(inst), 4};
+    case IR::Opcode::A64ReadMemory64:
+        return MemoryAccess{DecomposeA64Address(inst), 8};
+    case IR::Opcode::A64ReadMemory128:
+        return MemoryAccess{DecomposeA64Address(inst), 16};
+    default:
+        return std::nullopt;
+    }
+}
+
+std::optional<MemoryAccess> DecodeWrite(const IR::Inst& inst) {
+    constexpr u64 mask32 = 0xFFFFFFFF;
+
+    switch (inst.GetOpcode()) {
+    case IR::Opcode::A32WriteMemory8:
+        return MemoryAccess{DecomposeAddress(inst.GetArg(0), mask32), 1};
+    case IR::Opcode::A32WriteMemory16:
+        return MemoryAccess{DecomposeAddress(inst.GetArg(0), mask32), 2};
+    case IR::Opcode::A32WriteMemory32:
+        return MemoryAccess{DecomposeAddress(inst.GetArg(0), mask32), 4};
+    case IR::Opcode::A32WriteMemory64:
+        return MemoryAccess{DecomposeAddress(inst.GetArg(0), mask32), 8};
+    case IR::Opcode::A64WriteMemory8:
+        return MemoryAccess{DecomposeA64Address(inst), 1};
+    case IR::Opcode::A64WriteMemory16:
+        return MemoryAccess{DecomposeA64Address(inst), 2};
+    case IR::Opcode::A64WriteMemory32:
+        return MemoryAccess{DecomposeA64Address(inst), 4};
+    case IR::Opcode::A64WriteMemory64:
+        return MemoryAccess{DecomposeA64Address(inst), 8};
+    case IR::Opcode::A64WriteMemory128:
+        return MemoryAccess{DecomposeA64Address(inst), 16};
+    default:
+        return std::nullopt;
+    }
+}
+
+bool IsSameLocation(const MemoryAccess& a, const MemoryAccess& b) {
+    return a.address.base == b.address.base && a.address.offset == b.address.offset && a.bytes == b.bytes;
+}
+
+/// Two accesses are only known not to overlap if they are at constant distances from the same base.
+bool MayAlias(const MemoryAccess& a, const MemoryAccess& b) {
+    if (a.address.base != b.address.base) {
+        return true;
+    }
+
+    const u64 mask = a.address.mask;
+    const u64 distance = (b.address.offset - a.address.offset) & mask;
+    return distance < a.bytes || ((0 - distance) & mask) < b.bytes;
+}
+
+/// Instructions past which no knowledge of memory can be carried: these either order memory accesses,
+/// interact with the exclusive monitor, may leave the block, or call into user code.
+bool IsMemoryClobber(const IR::Inst& inst) {
+    switch (inst.GetOpcode()) {
+    case IR::Opcode::A64DataCacheOperationRaised:
+    case IR::Opcode::A64GetCNTPCT:
+        return true;
+    default:
+        break;
+    }
+
+    return inst.IsBarrier()
+        || inst.AltersExclusiveState()
+        || inst.CausesCPUException()
+        || inst.IsSetCheckBitOperation()
+        || inst.IsCoprocessorInstruction();
+}
+
+} // Anonymous namespace
+
+void RedundantLoadStoreElimination(IR::Block& block) {
+    std::vector<KnownValue> known;
+
+    // The most recent store, if no other memory access has been emitted since.
+    IR::Inst* last_store = nullptr;
+    std::optional<MemoryAccess> last_store_access;
+
+    for (auto& inst : block) {
+        if (IsMemoryClobber(inst)) {
+            known.clear();
+            last_store = nullptr;
+            continue;
+        }
+
+        if (const auto access = DecodeRead(inst)) {
+            const auto iter = std::find_if(known.begin(), known.end(), [&](const auto& entry) {
+                return IsSameLocation(entry.access, *access);
+            });
+            if (iter != known.end()) {
+                inst.ReplaceUsesWith(iter->value);
+                continue;
+            }
+
+            // Loads with acquire semantics are indistinguishable from plain loads in the IR,
+            // so nothing learnt before an actual read may be used past it.
+            known.clear();
+            known.push_back({*access, IR::Value{&inst}});
+            last_store = nullptr;
+            continue;
+        }
+
+        if (const auto access = DecodeWrite(inst)) {
+            // A store immediately overwritten by another to the same location is never observable.
+            if (last_store && IsSameLocation(*last_store_access, *access)) {
+                last_store->Invalidate();
+            }
+
+            known.erase(std::remove_if(known.begin(), known.end(), [&](const auto& entry) {
+                return MayAlias(entry.access, *access);
+            }), known.end());
+            // The value written is always the last argument.
+            known.push_back({*access, inst.GetArg(inst.NumArgs() - 1)});
+
+            last_store = &inst;
+            last_store_access = access;
+            continue;
+        }
+    }
+}
+
+} // namespace Dynarmic::Optimization
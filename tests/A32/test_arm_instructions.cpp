@@ -239,3 +239,70 @@ TEST_CASE("arm: Test InvalidateCacheRange", "[arm][A32]") {
     REQUIRE(jit.Regs()[15] == 0x0000000c);
     REQUIRE(jit.Cpsr() == 0x000001d0);
 }
+
+TEST_CASE("arm: vld1.32, vadd.i32, vst1.32", "[arm][A32]") {
+    ArmTestEnv test_env;
+    A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xf4200a8f, // vld1.32 {d0, d1}, [r0]
+        0xf2202840, // vadd.i32 q1, q0, q0
+        0xf4012a8f, // vst1.32 {d2, d3}, [r1]
+        0xeafffffe, // b +#0 (infinite loop)
+    };
+
+    jit.Regs()[0] = 0x100;
+    jit.Regs()[1] = 0x200;
+    jit.SetCpsr(0x000001d0); // User-mode
+
+    test_env.ticks_left = 4;
+    jit.Run();
+
+    REQUIRE(jit.ExtRegs()[0] == 0x03020100);
+    REQUIRE(jit.ExtRegs()[1] == 0x07060504);
+    REQUIRE(jit.ExtRegs()[2] == 0x0b0a0908);
+    REQUIRE(jit.ExtRegs()[3] == 0x0f0e0d0c);
+    REQUIRE(jit.ExtRegs()[4] == 0x06040200);
+    REQUIRE(jit.ExtRegs()[5] == 0x0e0c0a08);
+    REQUIRE(jit.ExtRegs()[6] == 0x16141210);
+    REQUIRE(jit.ExtRegs()[7] == 0x1e1c1a18);
+    REQUIRE(test_env.MemoryRead32(0x200) == 0x06040200);
+    REQUIRE(test_env.MemoryRead32(0x20c) == 0x1e1c1a18);
+    REQUIRE(jit.Regs()[15] == 0x0000000c);
+}
+
+TEST_CASE("arm: Shifts by register and bitfield operations", "[arm][A32]") {
+    ArmTestEnv test_env;
+    A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xe1a00211, // lsl r0, r1, r2
+        0xe1a03231, // lsr r3, r1, r2
+        0xe1a04251, // asr r4, r1, r2
+        0xe1a05611, // lsl r5, r1, r6
+        0xe1a07631, // lsr r7, r1, r6
+        0xe1a08651, // asr r8, r1, r6
+        0xe7eb9251, // ubfx r9, r1, #4, #12
+        0xe7abaa51, // sbfx r10, r1, #20, #12
+        0xe7d7b411, // bfi r11, r1, #8, #16
+        0xeafffffe, // b +#0 (infinite loop)
+    };
+
+    // Only the bottom byte of the shift register is used, so r2 shifts by 33 and r6 shifts by 4.
+    jit.Regs()[1] = 0x87654321;
+    jit.Regs()[2] = 0x121;
+    jit.Regs()[6] = 0x104;
+    jit.Regs()[11] = 0xAAAAAAAA;
+    jit.SetCpsr(0x000001d0); // User-mode
+
+    test_env.ticks_left = 10;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[0] == 0);
+    REQUIRE(jit.Regs()[3] == 0);
+    REQUIRE(jit.Regs()[4] == 0xFFFFFFFF);
+    REQUIRE(jit.Regs()[5] == 0x76543210);
+    REQUIRE(jit.Regs()[7] == 0x08765432);
+    REQUIRE(jit.Regs()[8] == 0xF8765432);
+    REQUIRE(jit.Regs()[9] == 0x00000432);
+    REQUIRE(jit.Regs()[10] == 0xFFFFF876);
+    REQUIRE(jit.Regs()[11] == 0xAA4321AA);
+}
@@ -4,11 +4,30 @@
  * General Public License version 2 or any later version.
  */
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <utility>
+#include <vector>
+
 #include <catch.hpp>
 
 #include <dynarmic/A64/exclusive_monitor.h>
 
+#include "common/crypto/aes.h"
+#include "common/crypto/crc32.h"
+#include "common/fp/fpcr.h"
 #include "common/fp/fpsr.h"
+#include "common/fp/op/FPCompare.h"
+#include "common/fp/op/FPConvert.h"
+#include "common/fp/op/FPMulAdd.h"
+#include "common/fp/op/FPRSqrtEstimate.h"
+#include "common/fp/op/FPRecipEstimate.h"
+#include "common/fp/op/FPRoundInt.h"
+#include "common/fp/rounding_mode.h"
+#include "common/fp/unpacked.h"
+#include "common/math_util.h"
+#include "rand_int.h"
 #include "testenv.h"
 
 namespace FP = Dynarmic::FP;
@@ -536,3 +555,1683 @@ TEST_CASE("A64: SQDMULH.4S (saturate)", "[a64]") {
     REQUIRE(jit.GetVector(0) == Vector{0x7ffffffe7fffffff, 0x8000000180000001});
     REQUIRE(FP::FPSR{jit.GetFpsr()}.QC() == true);
 }
+
+TEST_CASE("A64: AESE, AESMC, AESD, AESIMC", "[a64]") {
+    namespace AES = Dynarmic::Common::Crypto::AES;
+
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x4e284820); // AESE V0.16B, V1.16B
+    env.code_mem.emplace_back(0x4e286802); // AESMC V2.16B, V0.16B
+    env.code_mem.emplace_back(0x4e285823); // AESD V3.16B, V1.16B
+    env.code_mem.emplace_back(0x4e287864); // AESIMC V4.16B, V3.16B
+    env.code_mem.emplace_back(0x4e284825); // AESE V5.16B, V1.16B
+    env.code_mem.emplace_back(0x4e2868a5); // AESMC V5.16B, V5.16B
+    env.code_mem.emplace_back(0x4e285826); // AESD V6.16B, V1.16B
+    env.code_mem.emplace_back(0x4e2878c6); // AESIMC V6.16B, V6.16B
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    const Vector state = {0x0123456789abcdef, 0xfedcba9876543210};
+    const Vector key = {0x2b7e151628aed2a6, 0xabf7158809cf4f3c};
+
+    jit.SetPC(0);
+    jit.SetVector(0, state);
+    jit.SetVector(1, key);
+    jit.SetVector(3, state);
+    jit.SetVector(5, state);
+    jit.SetVector(6, state);
+
+    env.ticks_left = 9;
+    jit.Run();
+
+    const auto to_state = [](Vector v) {
+        AES::State result;
+        std::memcpy(result.data(), v.data(), sizeof(result));
+        return result;
+    };
+    const auto to_vector = [](const AES::State& s) {
+        Vector result;
+        std::memcpy(result.data(), s.data(), sizeof(result));
+        return result;
+    };
+
+    const AES::State xored = to_state({state[0] ^ key[0], state[1] ^ key[1]});
+    AES::State encrypted, mixed, decrypted, inverse_mixed;
+    AES::EncryptSingleRound(encrypted, xored);
+    AES::MixColumns(mixed, encrypted);
+    AES::DecryptSingleRound(decrypted, xored);
+    AES::InverseMixColumns(inverse_mixed, decrypted);
+
+    REQUIRE(jit.GetVector(0) == to_vector(encrypted));
+    REQUIRE(jit.GetVector(2) == to_vector(mixed));
+    REQUIRE(jit.GetVector(3) == to_vector(decrypted));
+    REQUIRE(jit.GetVector(4) == to_vector(inverse_mixed));
+    REQUIRE(jit.GetVector(5) == to_vector(mixed));
+    REQUIRE(jit.GetVector(6) == to_vector(inverse_mixed));
+}
+
+TEST_CASE("A64: SHA1C, SHA1M, SHA1P, SHA256H, SHA256H2, SHA256SU0, SHA256SU1", "[a64]") {
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x5e020023); // SHA1C Q3, S1, V2.4S
+    env.code_mem.emplace_back(0x5e022024); // SHA1M Q4, S1, V2.4S
+    env.code_mem.emplace_back(0x5e021025); // SHA1P Q5, S1, V2.4S
+    env.code_mem.emplace_back(0x5e024026); // SHA256H Q6, Q1, V2.4S
+    env.code_mem.emplace_back(0x5e025007); // SHA256H2 Q7, Q0, V2.4S
+    env.code_mem.emplace_back(0x5e282828); // SHA256SU0 V8.4S, V1.4S
+    env.code_mem.emplace_back(0x5e026029); // SHA256SU1 V9.4S, V1.4S, V2.4S
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    const Vector x = {0x67452301efcdab89, 0x98badcfe10325476};
+    const Vector y = {0x510e527f9b05688c, 0x1f83d9ab5be0cd19};
+    const Vector w = {0x428a2f9871374491, 0xb5c0fbcfe9b5dba5};
+
+    jit.SetPC(0);
+    jit.SetVector(0, x);
+    jit.SetVector(1, y);
+    jit.SetVector(2, w);
+    for (size_t i : {3, 4, 5, 6, 8, 9}) {
+        jit.SetVector(i, x);
+    }
+    jit.SetVector(7, y);
+
+    env.ticks_left = 8;
+    jit.Run();
+
+    // Expected values were produced by the generic IR expansion of these instructions.
+    REQUIRE(jit.GetVector(3) == Vector{0xb0d42ebc9dbb5b1b, 0x27ab3ed6c2b5f527});
+    REQUIRE(jit.GetVector(4) == Vector{0x8a6f85fad72432d0, 0x05891cb43e692bd6});
+    REQUIRE(jit.GetVector(5) == Vector{0xff262643b448a5d7, 0xfd6ff278ce5b4014});
+    REQUIRE(jit.GetVector(6) == Vector{0xee33d61837156707, 0xfc426ccc7d2ca3f7});
+    REQUIRE(jit.GetVector(7) == Vector{0xe5ad30e0e6ac4414, 0x1ca5f3994d558213});
+    REQUIRE(jit.GetVector(8) == Vector{0xe280cd2b36b42380, 0xe9305dff694bdc7e});
+    REQUIRE(jit.GetVector(9) == Vector{0x25d94c80977822a2, 0x99cb819344d6f57c});
+}
+
+TEST_CASE("A64: SM4E, SM4EKEY", "[a64]") {
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0xcec08422); // SM4E V2.4S, V1.4S
+    env.code_mem.emplace_back(0xce61c803); // SM4EKEY V3.4S, V0.4S, V1.4S
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    const Vector x = {0x89abcdef01234567, 0x76543210fedcba98};
+    const Vector k = {0x56aa3350a3b1bac6, 0xb27022dc677d9197};
+
+    jit.SetPC(0);
+    jit.SetVector(0, x);
+    jit.SetVector(1, k);
+    jit.SetVector(2, x);
+
+    env.ticks_left = 3;
+    jit.Run();
+
+    REQUIRE(jit.GetVector(2) == Vector{0xff26562bca1121fe, 0x6176715226c1cde4});
+    REQUIRE(jit.GetVector(3) == Vector{0xd6393a493111ff7e, 0x4f210d9343d00a97});
+}
+
+TEST_CASE("A64: CRC32B, CRC32H, CRC32W, CRC32X", "[a64]") {
+    namespace CRC32 = Dynarmic::Common::Crypto::CRC32;
+
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x1ac24020); // CRC32B W0, W1, W2
+    env.code_mem.emplace_back(0x1ac24423); // CRC32H W3, W1, W2
+    env.code_mem.emplace_back(0x1ac24824); // CRC32W W4, W1, W2
+    env.code_mem.emplace_back(0x9ac24c25); // CRC32X W5, W1, X2
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    for (size_t i = 0; i < 100; i++) {
+        const u32 crc = RandInt<u32>(0, 0xFFFFFFFF);
+        const u64 value = RandInt<u64>(0, 0xFFFFFFFF'FFFFFFFF);
+
+        jit.SetPC(0);
+        jit.SetRegister(1, crc);
+        jit.SetRegister(2, value);
+
+        env.ticks_left = 5;
+        jit.Run();
+
+        REQUIRE(jit.GetRegister(0) == CRC32::ComputeCRC32ISO(crc, value, 1));
+        REQUIRE(jit.GetRegister(3) == CRC32::ComputeCRC32ISO(crc, value, 2));
+        REQUIRE(jit.GetRegister(4) == CRC32::ComputeCRC32ISO(crc, value, 4));
+        REQUIRE(jit.GetRegister(5) == CRC32::ComputeCRC32ISO(crc, value, 8));
+    }
+}
+
+TEST_CASE("A64: FRINTN, FRINTP, FRINTM, FRINTZ, FRINTA, FRINTX (scalar)", "[a64]") {
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    const std::array<std::pair<u32, FP::RoundingMode>, 6> instructions{{
+        {0x1e244020, FP::RoundingMode::ToNearest_TieEven},         // FRINTN
+        {0x1e24c020, FP::RoundingMode::TowardsPlusInfinity},       // FRINTP
+        {0x1e254020, FP::RoundingMode::TowardsMinusInfinity},      // FRINTM
+        {0x1e25c020, FP::RoundingMode::TowardsZero},               // FRINTZ
+        {0x1e264020, FP::RoundingMode::ToNearest_TieAwayFromZero}, // FRINTA
+        {0x1e274020, FP::RoundingMode::ToNearest_TieEven},         // FRINTX
+    }};
+
+    // Each instruction is placed in its own block, first in single precision (S0, S1) and then double precision (D0, D1).
+    for (const auto& [instruction, rounding] : instructions) {
+        env.code_mem.emplace_back(instruction);
+        env.code_mem.emplace_back(0x14000000); // B .
+    }
+    for (const auto& [instruction, rounding] : instructions) {
+        env.code_mem.emplace_back(instruction | 0x00400000);
+        env.code_mem.emplace_back(0x14000000); // B .
+    }
+
+    const auto run = [&](size_t block, u64 input) {
+        jit.SetPC(block * 8);
+        jit.SetVector(1, {input, 0});
+        jit.SetFpsr(0);
+
+        env.ticks_left = 2;
+        jit.Run();
+
+        return std::make_pair(jit.GetVector(0)[0], FP::FPSR{jit.GetFpsr()});
+    };
+
+    const std::vector<u32> f32_inputs{
+        0x00000000, 0x80000000, 0x3f000000, 0xbf000000, 0x3fc00000, 0xbfc00000, 0x40200000, 0xc0200000,
+        0x3effffff, 0xbeffffff, 0x3f7fffff, 0x4b000000, 0x4b000001, 0x4afffffe, 0x4affffff, 0xcaffffff,
+        0x7f800000, 0xff800000, 0x7fc00000, 0x7f800001, 0x7f7fffff, 0x40490fdb, 0xc0490fdb, 0x00000001,
+    };
+    const std::vector<u64> f64_inputs{
+        0x0000000000000000, 0x8000000000000000, 0x3fe0000000000000, 0xbfe0000000000000, 0x3ff8000000000000,
+        0xbff8000000000000, 0x4004000000000000, 0xc004000000000000, 0x3fdfffffffffffff, 0x4330000000000000,
+        0x4330000000000001, 0x432fffffffffffff, 0xc32fffffffffffff, 0x7ff0000000000000, 0xfff0000000000000,
+        0x7ff8000000000000, 0x7ff0000000000001, 0x400921fb54442d18, 0xc00921fb54442d18, 0x0000000000000001,
+    };
+
+    // FRINTX rounds according to FPCR; the remaining instructions must be unaffected by it.
+    for (u32 fpcr_value : {0x00000000, 0x00400000, 0x00800000, 0x00c00000}) {
+        const FP::FPCR fpcr{fpcr_value};
+        jit.SetFpcr(fpcr_value);
+
+        for (size_t i = 0; i < instructions.size(); i++) {
+            const auto [instruction, instruction_rounding] = instructions[i];
+            const bool exact = i == instructions.size() - 1;
+            const FP::RoundingMode rounding = exact ? fpcr.RMode() : instruction_rounding;
+
+            for (u32 input : f32_inputs) {
+                FP::FPSR expected_fpsr;
+                const u64 expected = FP::FPRoundInt<u32>(input, fpcr, rounding, exact, expected_fpsr);
+                const auto [result, fpsr] = run(i, input);
+
+                INFO("instruction " << std::hex << instruction << " input " << input);
+                REQUIRE(result == expected);
+                REQUIRE(fpsr.IXC() == expected_fpsr.IXC());
+                REQUIRE(fpsr.IOC() == expected_fpsr.IOC());
+            }
+
+            for (u64 input : f64_inputs) {
+                FP::FPSR expected_fpsr;
+                const u64 expected = FP::FPRoundInt<u64>(input, fpcr, rounding, exact, expected_fpsr);
+                const auto [result, fpsr] = run(instructions.size() + i, input);
+
+                INFO("instruction " << std::hex << instruction << " input " << input);
+                REQUIRE(result == expected);
+                REQUIRE(fpsr.IXC() == expected_fpsr.IXC());
+                REQUIRE(fpsr.IOC() == expected_fpsr.IOC());
+            }
+        }
+    }
+}
+
+TEST_CASE("A64: TBL, TBX (1 to 4 registers)", "[a64]") {
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    // TBL/TBX V0.16B, {V4.16B - V(4+len).16B}, V1.16B; each in its own block.
+    for (u32 op : {0, 1}) {
+        for (u32 len = 0; len < 4; len++) {
+            env.code_mem.emplace_back(0x4e010080 | (len << 13) | (op << 12));
+            env.code_mem.emplace_back(0x14000000); // B .
+        }
+    }
+
+    const auto random_vector = [] {
+        return Vector{RandInt<u64>(0, 0xFFFFFFFF'FFFFFFFF), RandInt<u64>(0, 0xFFFFFFFF'FFFFFFFF)};
+    };
+    const auto get_byte = [](const Vector& v, size_t i) {
+        return static_cast<u8>(v[i / 8] >> (8 * (i % 8)));
+    };
+
+    for (size_t iteration = 0; iteration < 100; iteration++) {
+        const std::array<Vector, 4> tables{random_vector(), random_vector(), random_vector(), random_vector()};
+        const Vector defaults = random_vector();
+
+        // Bias the indices towards the range covered by the largest table.
+        Vector indices{};
+        for (size_t i = 0; i < 16; i++) {
+            const u64 index = RandInt<u32>(0, 3) == 0 ? RandInt<u32>(0, 0xFF) : RandInt<u32>(0, 0x4F);
+            indices[i / 8] |= index << (8 * (i % 8));
+        }
+
+        for (size_t op = 0; op < 2; op++) {
+            for (size_t len = 0; len < 4; len++) {
+                Vector expected{};
+                for (size_t i = 0; i < 16; i++) {
+                    const size_t index = get_byte(indices, i);
+                    const u64 element = index < (len + 1) * 16 ? get_byte(tables[index / 16], index % 16)
+                                                               : op == 1 ? get_byte(defaults, i) : 0;
+                    expected[i / 8] |= element << (8 * (i % 8));
+                }
+
+                jit.SetPC((op * 4 + len) * 8);
+                jit.SetVector(0, defaults);
+                jit.SetVector(1, indices);
+                for (size_t i = 0; i < tables.size(); i++) {
+                    jit.SetVector(4 + i, tables[i]);
+                }
+
+                env.ticks_left = 2;
+                jit.Run();
+
+                INFO("op " << op << " len " << len);
+                REQUIRE(jit.GetVector(0) == expected);
+            }
+        }
+    }
+}
+
+TEST_CASE("A64: PMUL, PMULL, PMULL2", "[a64]") {
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    // Each instruction is V0 = op(V1, V2) in its own block.
+    env.code_mem.emplace_back(0x6e229c20); // PMUL V0.16B, V1.16B, V2.16B
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x0e22e020); // PMULL V0.8H, V1.8B, V2.8B
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x4e22e020); // PMULL2 V0.8H, V1.16B, V2.16B
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x0ee2e020); // PMULL V0.1Q, V1.1D, V2.1D
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x4ee2e020); // PMULL2 V0.1Q, V1.2D, V2.2D
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    const auto clmul = [](u64 a, u64 b) {
+        std::pair<u64, u64> result{};
+        for (size_t i = 0; i < 64; i++) {
+            if ((a >> i) & 1) {
+                result.first ^= b << i;
+                result.second ^= i == 0 ? 0 : b >> (64 - i);
+            }
+        }
+        return result;
+    };
+    const auto pmul8 = [&](const Vector& a, const Vector& b, size_t esize, size_t part) {
+        Vector result{};
+        const size_t count = esize == 8 ? 16 : 8;
+        for (size_t i = 0; i < count; i++) {
+            const size_t src = esize == 8 ? i : part * 8 + i;
+            const u64 product = clmul((a[src / 8] >> (8 * (src % 8))) & 0xFF, (b[src / 8] >> (8 * (src % 8))) & 0xFF).first;
+            const size_t ebytes = esize / 8;
+            const u64 element = esize == 8 ? product & 0xFF : product;
+            result[(i * ebytes) / 8] |= element << (8 * ((i * ebytes) % 8));
+        }
+        return result;
+    };
+
+    for (size_t iteration = 0; iteration < 100; iteration++) {
+        const Vector a{RandInt<u64>(0, 0xFFFFFFFF'FFFFFFFF), RandInt<u64>(0, 0xFFFFFFFF'FFFFFFFF)};
+        const Vector b{RandInt<u64>(0, 0xFFFFFFFF'FFFFFFFF), RandInt<u64>(0, 0xFFFFFFFF'FFFFFFFF)};
+
+        const auto [lo0, hi0] = clmul(a[0], b[0]);
+        const auto [lo1, hi1] = clmul(a[1], b[1]);
+        const std::array<Vector, 5> expected{
+            pmul8(a, b, 8, 0),
+            pmul8(a, b, 16, 0),
+            pmul8(a, b, 16, 1),
+            Vector{lo0, hi0},
+            Vector{lo1, hi1},
+        };
+
+        for (size_t i = 0; i < expected.size(); i++) {
+            jit.SetPC(i * 8);
+            jit.SetVector(1, a);
+            jit.SetVector(2, b);
+
+            env.ticks_left = 2;
+            jit.Run();
+
+            INFO("instruction " << i);
+            REQUIRE(jit.GetVector(0) == expected[i]);
+        }
+    }
+}
+
+TEST_CASE("A64: SSHL, USHL, SRSHL, URSHL (vector)", "[a64]") {
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    // {S|U}{R}SHL V0.<T>, V1.<T>, V2.<T> for every element size; each in its own block.
+    for (u32 U : {0, 1}) {
+        for (u32 R : {0, 1}) {
+            for (u32 size = 0; size < 4; size++) {
+                env.code_mem.emplace_back(0x4e224420 | (U << 29) | (size << 22) | (R << 12));
+                env.code_mem.emplace_back(0x14000000); // B .
+            }
+        }
+    }
+
+    const auto shift_right = [](u64 value, size_t esize, bool is_signed, s64 amount) -> u64 {
+        if (!is_signed) {
+            return amount >= 64 ? 0 : value >> amount;
+        }
+        const s64 sign_extended = static_cast<s64>(value << (64 - esize)) >> (64 - esize);
+        return static_cast<u64>(sign_extended >> std::min<s64>(amount, 63));
+    };
+    const auto reference = [&](u64 value, u64 shift_lane, size_t esize, bool is_signed, bool rounding) -> u64 {
+        const s64 shift = static_cast<s8>(static_cast<u8>(shift_lane));
+        const u64 mask = esize == 64 ? ~u64(0) : (u64(1) << esize) - 1;
+        if (shift >= 0) {
+            return shift >= 64 ? 0 : (value << shift) & mask;
+        }
+        u64 result = shift_right(value, esize, is_signed, -shift);
+        if (rounding) {
+            result += shift_right(value, esize, is_signed, -shift - 1) & 1;
+        }
+        return result & mask;
+    };
+
+    for (size_t iteration = 0; iteration < 100; iteration++) {
+        const Vector value{RandInt<u64>(0, 0xFFFFFFFF'FFFFFFFF), RandInt<u64>(0, 0xFFFFFFFF'FFFFFFFF)};
+
+        for (size_t U = 0; U < 2; U++) {
+            for (size_t R = 0; R < 2; R++) {
+                for (size_t size = 0; size < 4; size++) {
+                    const size_t esize = size_t(8) << size;
+                    const u64 mask = esize == 64 ? ~u64(0) : (u64(1) << esize) - 1;
+
+                    // Bias the shift amounts towards the interesting range around +/- esize.
+                    Vector shift = {RandInt<u64>(0, 0xFFFFFFFF'FFFFFFFF), RandInt<u64>(0, 0xFFFFFFFF'FFFFFFFF)};
+                    Vector expected{};
+                    for (size_t i = 0; i < 128 / esize; i++) {
+                        const size_t bit = i * esize;
+                        if (RandInt<u32>(0, 3) != 0) {
+                            const s64 amount = RandInt<s64>(-static_cast<s64>(esize) - 2, static_cast<s64>(esize) + 2);
+                            shift[bit / 64] &= ~(u64(0xFF) << (bit % 64));
+                            shift[bit / 64] |= (static_cast<u64>(amount) & 0xFF) << (bit % 64);
+                        }
+
+                        const u64 lane = (value[bit / 64] >> (bit % 64)) & mask;
+                        const u64 shift_lane = (shift[bit / 64] >> (bit % 64)) & mask;
+                        expected[bit / 64] |= reference(lane, shift_lane, esize, U == 0, R == 1) << (bit % 64);
+                    }
+
+                    jit.SetPC(((U * 2 + R) * 4 + size) * 8);
+                    jit.SetVector(1, value);
+                    jit.SetVector(2, shift);
+
+                    env.ticks_left = 2;
+                    jit.Run();
+
+                    INFO("U " << U << " R " << R << " size " << size);
+                    REQUIRE(jit.GetVector(0) == expected);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("A64: SMAXP, UMAXP, SMINP, UMINP (8-bit and 16-bit), CMGT, CMHI, CMHS (64-bit)", "[a64]") {
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    // {S|U}{MAX|MIN}P V0.<T>, V1.<T>, V2.<T> for T in {16B, 8H}; each in its own block.
+    for (u32 U : {0, 1}) {
+        for (u32 is_min : {0, 1}) {
+            for (u32 size : {0, 1}) {
+                env.code_mem.emplace_back(0x4e22a420 | (U << 29) | (size << 22) | (is_min << 11));
+                env.code_mem.emplace_back(0x14000000); // B .
+            }
+        }
+    }
+    env.code_mem.emplace_back(0x4ee23420); // CMGT V0.2D, V1.2D, V2.2D
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x6ee23420); // CMHI V0.2D, V1.2D, V2.2D
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x6ee23c20); // CMHS V0.2D, V1.2D, V2.2D
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    const auto run = [&](size_t block, const Vector& a, const Vector& b) {
+        jit.SetPC(block * 8);
+        jit.SetVector(1, a);
+        jit.SetVector(2, b);
+
+        env.ticks_left = 2;
+        jit.Run();
+
+        return jit.GetVector(0);
+    };
+
+    for (size_t iteration = 0; iteration < 100; iteration++) {
+        const Vector a{RandInt<u64>(0, 0xFFFFFFFF'FFFFFFFF), RandInt<u64>(0, 0xFFFFFFFF'FFFFFFFF)};
+        Vector b{RandInt<u64>(0, 0xFFFFFFFF'FFFFFFFF), RandInt<u64>(0, 0xFFFFFFFF'FFFFFFFF)};
+        if (RandInt<u32>(0, 3) == 0) {
+            b[1] = a[1];
+        }
+
+        for (size_t U = 0; U < 2; U++) {
+            for (size_t is_min = 0; is_min < 2; is_min++) {
+                for (size_t size = 0; size < 2; size++) {
+                    const size_t esize = size_t(8) << size;
+                    const size_t lanes = 128 / esize;
+                    const auto get = [&](const Vector& v, size_t i) -> s64 {
+                        const u64 raw = (v[i * esize / 64] >> (i * esize % 64)) & ((u64(1) << esize) - 1);
+                        return U == 1 ? static_cast<s64>(raw) : static_cast<s64>(raw << (64 - esize)) >> (64 - esize);
+                    };
+
+                    Vector expected{};
+                    for (size_t i = 0; i < lanes; i++) {
+                        const Vector& source = i < lanes / 2 ? a : b;
+                        const size_t j = (i % (lanes / 2)) * 2;
+                        const s64 element = is_min ? std::min(get(source, j), get(source, j + 1)) : std::max(get(source, j), get(source, j + 1));
+                        expected[i * esize / 64] |= (static_cast<u64>(element) & ((u64(1) << esize) - 1)) << (i * esize % 64);
+                    }
+
+                    INFO("U " << U << " min " << is_min << " size " << size);
+                    REQUIRE(run((U * 2 + is_min) * 2 + size, a, b) == expected);
+                }
+            }
+        }
+
+        const auto mask = [](bool condition) { return condition ? ~u64(0) : u64(0); };
+        REQUIRE(run(8, a, b) == Vector{mask(s64(a[0]) > s64(b[0])), mask(s64(a[1]) > s64(b[1]))});
+        REQUIRE(run(9, a, b) == Vector{mask(a[0] > b[0]), mask(a[1] > b[1])});
+        REQUIRE(run(10, a, b) == Vector{mask(a[0] >= b[0]), mask(a[1] >= b[1])});
+    }
+}
+
+TEST_CASE("A64: CLZ, CNT (vector)", "[a64]") {
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    // CLZ V0.<T>, V1.<T> for T in {16B, 8H, 4S}, then CNT V0.16B, V1.16B; each in its own block.
+    for (u32 size = 0; size < 3; size++) {
+        env.code_mem.emplace_back(0x6e204820 | (size << 22));
+        env.code_mem.emplace_back(0x14000000); // B .
+    }
+    env.code_mem.emplace_back(0x4e205820);
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    for (size_t iteration = 0; iteration < 200; iteration++) {
+        // Shift random values right by a random amount to get a spread of leading zero counts.
+        Vector value{};
+        for (size_t i = 0; i < 8; i++) {
+            const u64 half = RandInt<u32>(0, 0xFFFF) >> RandInt<u32>(0, 16);
+            value[i / 4] |= half << (16 * (i % 4));
+        }
+
+        for (size_t block = 0; block < 4; block++) {
+            const size_t esize = block == 3 ? 8 : size_t(8) << block;
+            const u64 mask = (u64(1) << esize) - 1;
+
+            Vector expected{};
+            for (size_t i = 0; i < 128 / esize; i++) {
+                const u64 lane = (value[i * esize / 64] >> (i * esize % 64)) & mask;
+                u64 count = 0;
+                if (block == 3) {
+                    for (size_t bit = 0; bit < esize; bit++) {
+                        count += (lane >> bit) & 1;
+                    }
+                } else {
+                    while (count < esize && ((lane >> (esize - 1 - count)) & 1) == 0) {
+                        count++;
+                    }
+                }
+                expected[i * esize / 64] |= count << (i * esize % 64);
+            }
+
+            jit.SetPC(block * 8);
+            jit.SetVector(1, value);
+
+            env.ticks_left = 2;
+            jit.Run();
+
+            INFO("block " << block);
+            REQUIRE(jit.GetVector(0) == expected);
+        }
+    }
+}
+
+TEST_CASE("A64: FMADD, FMLA with NaNs and infinities", "[a64]") {
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x1f020c20); // FMADD S0, S1, S2, S3
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x1f420c20); // FMADD D0, D1, D2, D3
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x4e22cc20); // FMLA V0.4S, V1.4S, V2.4S
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x4e62cc20); // FMLA V0.2D, V1.2D, V2.2D
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    const std::array<u32, 9> f32_inputs{0x00000000, 0x80000000, 0x3fc00000, 0xc0200000, 0x7f800000, 0xff800000, 0x7fc00001, 0xffa00002, 0x7f7fffff};
+    const std::array<u64, 9> f64_inputs{0x0000000000000000, 0x8000000000000000, 0x3ff8000000000000, 0xc004000000000000, 0x7ff0000000000000,
+                                        0xfff0000000000000, 0x7ff8000000000001, 0xfff4000000000002, 0x7fefffffffffffff};
+
+    const auto run = [&](size_t block, const Vector& addend, const Vector& op1, const Vector& op2) {
+        jit.SetPC(block * 8);
+        jit.SetVector(0, addend);
+        jit.SetVector(1, op1);
+        jit.SetVector(2, op2);
+        jit.SetVector(3, addend);
+        jit.SetFpsr(0);
+
+        env.ticks_left = 2;
+        jit.Run();
+
+        return std::make_pair(jit.GetVector(0), FP::FPSR{jit.GetFpsr()});
+    };
+
+    for (u32 fpcr_value : {0x00000000, 0x02000000}) {
+        const FP::FPCR fpcr{fpcr_value};
+        jit.SetFpcr(fpcr_value);
+
+        for (u32 a : f32_inputs) {
+            for (u32 b : f32_inputs) {
+                for (u32 c : f32_inputs) {
+                    FP::FPSR expected_fpsr;
+                    const u32 expected = FP::FPMulAdd<u32>(a, b, c, fpcr, expected_fpsr);
+                    const auto [result, fpsr] = run(0, {a, 0}, {b, 0}, {c, 0});
+
+                    INFO("fpcr " << std::hex << fpcr_value << " inputs " << a << " " << b << " " << c);
+                    REQUIRE(result[0] == expected);
+                    REQUIRE(fpsr.IOC() == expected_fpsr.IOC());
+                }
+            }
+        }
+
+        for (u64 a : f64_inputs) {
+            for (u64 b : f64_inputs) {
+                for (u64 c : f64_inputs) {
+                    FP::FPSR expected_fpsr;
+                    const u64 expected = FP::FPMulAdd<u64>(a, b, c, fpcr, expected_fpsr);
+                    const auto [result, fpsr] = run(1, {a, 0}, {b, 0}, {c, 0});
+
+                    INFO("fpcr " << std::hex << fpcr_value << " inputs " << a << " " << b << " " << c);
+                    REQUIRE(result[0] == expected);
+                    REQUIRE(fpsr.IOC() == expected_fpsr.IOC());
+                }
+            }
+        }
+
+        for (size_t iteration = 0; iteration < 200; iteration++) {
+            Vector addend{}, op1{}, op2{}, expected{};
+            FP::FPSR expected_fpsr;
+            for (size_t i = 0; i < 4; i++) {
+                const u32 a = f32_inputs[RandInt<size_t>(0, f32_inputs.size() - 1)];
+                const u32 b = f32_inputs[RandInt<size_t>(0, f32_inputs.size() - 1)];
+                const u32 c = f32_inputs[RandInt<size_t>(0, f32_inputs.size() - 1)];
+                addend[i / 2] |= u64(a) << (32 * (i % 2));
+                op1[i / 2] |= u64(b) << (32 * (i % 2));
+                op2[i / 2] |= u64(c) << (32 * (i % 2));
+                expected[i / 2] |= u64(FP::FPMulAdd<u32>(a, b, c, fpcr, expected_fpsr)) << (32 * (i % 2));
+            }
+            const auto [result, fpsr] = run(2, addend, op1, op2);
+
+            INFO("fpcr " << std::hex << fpcr_value << " inputs " << addend[0] << addend[1] << " " << op1[0] << op1[1] << " " << op2[0] << op2[1]);
+            REQUIRE(result == expected);
+            REQUIRE(fpsr.IOC() == expected_fpsr.IOC());
+        }
+
+        for (size_t iteration = 0; iteration < 200; iteration++) {
+            Vector addend{}, op1{}, op2{}, expected{};
+            FP::FPSR expected_fpsr;
+            for (size_t i = 0; i < 2; i++) {
+                addend[i] = f64_inputs[RandInt<size_t>(0, f64_inputs.size() - 1)];
+                op1[i] = f64_inputs[RandInt<size_t>(0, f64_inputs.size() - 1)];
+                op2[i] = f64_inputs[RandInt<size_t>(0, f64_inputs.size() - 1)];
+                expected[i] = FP::FPMulAdd<u64>(addend[i], op1[i], op2[i], fpcr, expected_fpsr);
+            }
+            const auto [result, fpsr] = run(3, addend, op1, op2);
+
+            INFO("fpcr " << std::hex << fpcr_value << " inputs " << addend[0] << " " << addend[1] << " " << op1[0] << " " << op1[1] << " " << op2[0] << " " << op2[1]);
+            REQUIRE(result == expected);
+            REQUIRE(fpsr.IOC() == expected_fpsr.IOC());
+        }
+    }
+}
+
+TEST_CASE("A64: FRECPE, FRSQRTE, URECPE, URSQRTE", "[a64]") {
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x5ea1d820); // FRECPE S0, S1
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x5ee1d820); // FRECPE D0, D1
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x7ea1d820); // FRSQRTE S0, S1
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x7ee1d820); // FRSQRTE D0, D1
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x4ea1d820); // FRECPE V0.4S, V1.4S
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x4ee1d820); // FRECPE V0.2D, V1.2D
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x6ea1d820); // FRSQRTE V0.4S, V1.4S
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x6ee1d820); // FRSQRTE V0.2D, V1.2D
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x4ea1c820); // URECPE V0.4S, V1.4S
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x6ea1c820); // URSQRTE V0.4S, V1.4S
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    const std::array<u32, 14> f32_special{0x00000000, 0x80000000, 0x00000001, 0x00400000, 0x00800000, 0x3f800000, 0xbf800000,
+                                          0x7e7fffff, 0x7e800000, 0x7f7fffff, 0x7f800000, 0xff800000, 0x7fc00000, 0x7f800001};
+    const std::array<u64, 14> f64_special{0x0000000000000000, 0x8000000000000000, 0x0000000000000001, 0x0008000000000000, 0x0010000000000000,
+                                          0x3ff0000000000000, 0xbff0000000000000, 0x7fcfffffffffffff, 0x7fd0000000000000, 0x7fefffffffffffff,
+                                          0x7ff0000000000000, 0xfff0000000000000, 0x7ff8000000000000, 0x7ff0000000000001};
+
+    const auto random_f32 = [&] {
+        return RandInt<int>(0, 3) == 0 ? f32_special[RandInt<size_t>(0, f32_special.size() - 1)] : RandInt<u32>(0, 0xFFFFFFFF);
+    };
+    const auto random_f64 = [&] {
+        return RandInt<int>(0, 3) == 0 ? f64_special[RandInt<size_t>(0, f64_special.size() - 1)] : RandInt<u64>(0, 0xFFFFFFFFFFFFFFFF);
+    };
+    const auto random_f32_pair = [&] {
+        return u64(random_f32()) | (u64(random_f32()) << 32);
+    };
+
+    const auto run = [&](size_t block, const Vector& operand) {
+        jit.SetPC(block * 8);
+        jit.SetVector(0, {0, 0});
+        jit.SetVector(1, operand);
+        jit.SetFpsr(0);
+
+        env.ticks_left = 2;
+        jit.Run();
+
+        return std::make_pair(jit.GetVector(0), jit.GetFpsr());
+    };
+
+    const auto lanewise = [](const Vector& operand, auto fn) {
+        Vector result{};
+        for (size_t i = 0; i < 4; i++) {
+            const u32 element = static_cast<u32>(operand[i / 2] >> (32 * (i % 2)));
+            result[i / 2] |= u64(fn(element)) << (32 * (i % 2));
+        }
+        return result;
+    };
+
+    for (u32 fpcr_value : {0x00000000, 0x01000000, 0x02000000, 0x00c00000}) {
+        const FP::FPCR fpcr{fpcr_value};
+        jit.SetFpcr(fpcr_value);
+
+        for (size_t iteration = 0; iteration < 500; iteration++) {
+            const u32 a32 = random_f32();
+            const u64 a64 = random_f64();
+            const Vector v32{random_f32_pair(), random_f32_pair()};
+            const Vector v64{random_f64(), random_f64()};
+
+            INFO("fpcr " << std::hex << fpcr_value << " inputs " << a32 << " " << a64 << " " << v32[0] << " " << v32[1] << " " << v64[0] << " " << v64[1]);
+
+            {
+                FP::FPSR fpsr;
+                const Vector expected{FP::FPRecipEstimate<u32>(a32, fpcr, fpsr), 0};
+                REQUIRE(run(0, {a32, 0}) == std::make_pair(expected, fpsr.Value()));
+            }
+            {
+                FP::FPSR fpsr;
+                const Vector expected{FP::FPRecipEstimate<u64>(a64, fpcr, fpsr), 0};
+                REQUIRE(run(1, {a64, 0}) == std::make_pair(expected, fpsr.Value()));
+            }
+            {
+                FP::FPSR fpsr;
+                const Vector expected{FP::FPRSqrtEstimate<u32>(a32, fpcr, fpsr), 0};
+                REQUIRE(run(2, {a32, 0}) == std::make_pair(expected, fpsr.Value()));
+            }
+            {
+                FP::FPSR fpsr;
+                const Vector expected{FP::FPRSqrtEstimate<u64>(a64, fpcr, fpsr), 0};
+                REQUIRE(run(3, {a64, 0}) == std::make_pair(expected, fpsr.Value()));
+            }
+            {
+                FP::FPSR fpsr;
+                const Vector expected = lanewise(v32, [&](u32 x) { return FP::FPRecipEstimate<u32>(x, fpcr, fpsr); });
+                REQUIRE(run(4, v32) == std::make_pair(expected, fpsr.Value()));
+            }
+            {
+                FP::FPSR fpsr;
+                const Vector expected{FP::FPRecipEstimate<u64>(v64[0], fpcr, fpsr), FP::FPRecipEstimate<u64>(v64[1], fpcr, fpsr)};
+                REQUIRE(run(5, v64) == std::make_pair(expected, fpsr.Value()));
+            }
+            {
+                FP::FPSR fpsr;
+                const Vector expected = lanewise(v32, [&](u32 x) { return FP::FPRSqrtEstimate<u32>(x, fpcr, fpsr); });
+                REQUIRE(run(6, v32) == std::make_pair(expected, fpsr.Value()));
+            }
+            {
+                FP::FPSR fpsr;
+                const Vector expected{FP::FPRSqrtEstimate<u64>(v64[0], fpcr, fpsr), FP::FPRSqrtEstimate<u64>(v64[1], fpcr, fpsr)};
+                REQUIRE(run(7, v64) == std::make_pair(expected, fpsr.Value()));
+            }
+        }
+    }
+
+    for (size_t iteration = 0; iteration < 500; iteration++) {
+        const Vector v{RandInt<u64>(0, 0xFFFFFFFFFFFFFFFF), RandInt<u64>(0, 0xFFFFFFFFFFFFFFFF)};
+
+        INFO("inputs " << std::hex << v[0] << " " << v[1]);
+
+        const Vector expected_recip = lanewise(v, [](u32 x) -> u32 {
+            if ((x & 0x80000000) == 0) {
+                return 0xFFFFFFFF;
+            }
+            return (0x100 | Dynarmic::Common::RecipEstimate(x >> 23)) << 23;
+        });
+        REQUIRE(run(8, v).first == expected_recip);
+
+        const Vector expected_rsqrt = lanewise(v, [](u32 x) -> u32 {
+            if ((x & 0xC0000000) == 0) {
+                return 0xFFFFFFFF;
+            }
+            return (0x100 | Dynarmic::Common::RecipSqrtEstimate(x >> 23)) << 23;
+        });
+        REQUIRE(run(9, v).first == expected_rsqrt);
+    }
+}
+
+TEST_CASE("A64: FADD, FSUB, FMUL, FABD (vector, half-precision)", "[a64]") {
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x4e421420); // FADD V0.8H, V1.8H, V2.8H
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x4ec21420); // FSUB V0.8H, V1.8H, V2.8H
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x6e421c20); // FMUL V0.8H, V1.8H, V2.8H
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x6ec21420); // FABD V0.8H, V1.8H, V2.8H
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x0e421420); // FADD V0.4H, V1.4H, V2.4H
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    const std::array<u16, 14> special{0x0000, 0x8000, 0x0001, 0x03ff, 0x0400, 0x3c00, 0xbc00,
+                                      0x7bff, 0xfbff, 0x7c00, 0xfc00, 0x7e00, 0x7c01, 0xfe01};
+
+    const auto random_vector = [&] {
+        Vector result{};
+        for (size_t i = 0; i < 8; i++) {
+            const u16 element = RandInt<int>(0, 2) == 0 ? special[RandInt<size_t>(0, special.size() - 1)] : RandInt<u16>(0, 0xFFFF);
+            result[i / 4] |= u64(element) << (16 * (i % 4));
+        }
+        return result;
+    };
+
+    const auto lanewise = [](size_t lanes, const Vector& a, const Vector& b, auto fn) {
+        Vector result{};
+        for (size_t i = 0; i < lanes; i++) {
+            const u16 x = static_cast<u16>(a[i / 4] >> (16 * (i % 4)));
+            const u16 y = static_cast<u16>(b[i / 4] >> (16 * (i % 4)));
+            result[i / 4] |= u64(fn(x, y)) << (16 * (i % 4));
+        }
+        return result;
+    };
+
+    const auto run = [&](size_t block, const Vector& a, const Vector& b) {
+        jit.SetPC(block * 8);
+        jit.SetVector(0, {0, 0});
+        jit.SetVector(1, a);
+        jit.SetVector(2, b);
+
+        env.ticks_left = 2;
+        jit.Run();
+
+        return jit.GetVector(0);
+    };
+
+    constexpr u16 one = 0x3c00;
+    constexpr u16 minus_one = 0xbc00;
+
+    for (u32 fpcr_value : {0x00000000, 0x02000000, 0x00400000, 0x00800000, 0x00c00000, 0x01000000, 0x00080000}) {
+        const FP::FPCR fpcr{fpcr_value};
+        jit.SetFpcr(fpcr_value);
+
+        for (size_t iteration = 0; iteration < 500; iteration++) {
+            const Vector a = random_vector();
+            const Vector b = random_vector();
+            FP::FPSR fpsr;
+
+            const auto add = [&](u16 x, u16 y) { return FP::FPMulAdd<u16>(x, y, one, fpcr, fpsr); };
+            const auto sub = [&](u16 x, u16 y) { return FP::FPMulAdd<u16>(x, y, minus_one, fpcr, fpsr); };
+            const auto mul = [&](u16 x, u16 y) { return FP::FPMulAdd<u16>(static_cast<u16>((x ^ y) & 0x8000), x, y, fpcr, fpsr); };
+            const auto abd = [&](u16 x, u16 y) { return static_cast<u16>(sub(x, y) & 0x7fff); };
+
+            INFO("fpcr " << std::hex << fpcr_value << " inputs " << a[0] << " " << a[1] << " " << b[0] << " " << b[1]);
+            REQUIRE(run(0, a, b) == lanewise(8, a, b, add));
+            REQUIRE(run(1, a, b) == lanewise(8, a, b, sub));
+            REQUIRE(run(2, a, b) == lanewise(8, a, b, mul));
+            REQUIRE(run(3, a, b) == lanewise(8, a, b, abd));
+            REQUIRE(run(4, a, b) == lanewise(4, a, b, add));
+        }
+    }
+}
+
+TEST_CASE("A64: FMLA, FMULX, FCMEQ, FCMGE, FCMGT, FACGE, FACGT (vector, half-precision)", "[a64]") {
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x4e420c20); // FMLA V0.8H, V1.8H, V2.8H
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x4e421c20); // FMULX V0.8H, V1.8H, V2.8H
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x4e422420); // FCMEQ V0.8H, V1.8H, V2.8H
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x6e422420); // FCMGE V0.8H, V1.8H, V2.8H
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x6ec22420); // FCMGT V0.8H, V1.8H, V2.8H
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x6e422c20); // FACGE V0.8H, V1.8H, V2.8H
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x6ec22c20); // FACGT V0.8H, V1.8H, V2.8H
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x6ef8c820); // FCMGE V0.8H, V1.8H, #0.0
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x4ef8c820); // FCMGT V0.8H, V1.8H, #0.0
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x6ef8d820); // FCMLE V0.8H, V1.8H, #0.0
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x4ef8e820); // FCMLT V0.8H, V1.8H, #0.0
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x0e421c20); // FMULX V0.4H, V1.4H, V2.4H
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    const std::array<u16, 14> special{0x0000, 0x8000, 0x0001, 0x03ff, 0x0400, 0x3c00, 0xbc00,
+                                      0x7bff, 0xfbff, 0x7c00, 0xfc00, 0x7e00, 0x7c01, 0xfe01};
+
+    const auto random_vector = [&] {
+        Vector result{};
+        for (size_t i = 0; i < 8; i++) {
+            const u16 element = RandInt<int>(0, 2) == 0 ? special[RandInt<size_t>(0, special.size() - 1)] : RandInt<u16>(0, 0xFFFF);
+            result[i / 4] |= u64(element) << (16 * (i % 4));
+        }
+        return result;
+    };
+
+    const auto lanewise = [](size_t lanes, const Vector& a, const Vector& b, const Vector& c, auto fn) {
+        Vector result{};
+        for (size_t i = 0; i < lanes; i++) {
+            const u16 x = static_cast<u16>(a[i / 4] >> (16 * (i % 4)));
+            const u16 y = static_cast<u16>(b[i / 4] >> (16 * (i % 4)));
+            const u16 z = static_cast<u16>(c[i / 4] >> (16 * (i % 4)));
+            result[i / 4] |= u64(fn(x, y, z)) << (16 * (i % 4));
+        }
+        return result;
+    };
+
+    const auto run = [&](size_t block, const Vector& a, const Vector& b, const Vector& c) {
+        jit.SetPC(block * 8);
+        jit.SetVector(0, c);
+        jit.SetVector(1, a);
+        jit.SetVector(2, b);
+        jit.SetFpsr(0);
+
+        env.ticks_left = 2;
+        jit.Run();
+
+        return jit.GetVector(0);
+    };
+
+    // Products of these operands are exactly halfway between two half-precision values (or a zero minimum
+    // subnormal away from it), where a single-precision fused multiply-add would be rounded incorrectly.
+    const std::array<std::array<u16, 3>, 4> double_rounding{{
+        {0x4640, 0x5808, 0x006d},
+        {0x0a5d, 0x5e21, 0x4776},
+        {0x46e0, 0x5de0, 0x0414},
+        {0x3890, 0x7a20, 0x13f8},
+    }};
+
+    for (u32 fpcr_value : {0x00000000, 0x02000000, 0x00400000, 0x00800000, 0x00c00000, 0x01000000, 0x00080000}) {
+        const FP::FPCR fpcr{fpcr_value};
+        jit.SetFpcr(fpcr_value);
+
+        for (size_t iteration = 0; iteration < 500; iteration++) {
+            Vector a = random_vector();
+            Vector b = random_vector();
+            Vector c = random_vector();
+            if (iteration == 0) {
+                for (size_t i = 0; i < double_rounding.size(); i++) {
+                    a[i / 4] = (a[i / 4] & ~(u64(0xFFFF) << (16 * (i % 4)))) | u64(double_rounding[i][0]) << (16 * (i % 4));
+                    b[i / 4] = (b[i / 4] & ~(u64(0xFFFF) << (16 * (i % 4)))) | u64(double_rounding[i][1]) << (16 * (i % 4));
+                    c[i / 4] = (c[i / 4] & ~(u64(0xFFFF) << (16 * (i % 4)))) | u64(double_rounding[i][2]) << (16 * (i % 4));
+                }
+            }
+
+            FP::FPSR fpsr;
+            const auto mla = [&](u16 x, u16 y, u16 z) { return FP::FPMulAdd<u16>(z, x, y, fpcr, fpsr); };
+            const auto mulx = [&](u16 x, u16 y, u16) -> u16 {
+                const auto type1 = std::get<FP::FPType>(FP::FPUnpack<u16>(x, fpcr, fpsr));
+                const auto type2 = std::get<FP::FPType>(FP::FPUnpack<u16>(y, fpcr, fpsr));
+                const u16 sign = static_cast<u16>((x ^ y) & 0x8000);
+                if ((type1 == FP::FPType::Infinity && type2 == FP::FPType::Zero) || (type1 == FP::FPType::Zero && type2 == FP::FPType::Infinity)) {
+                    return static_cast<u16>(sign | 0x4000);
+                }
+                return FP::FPMulAdd<u16>(sign, x, y, fpcr, fpsr);
+            };
+            const auto mask = [](bool value) -> u16 { return value ? 0xFFFF : 0; };
+            const auto cmeq = [&](u16 x, u16 y, u16) { return mask(FP::FPCompareEQ<u16>(x, y, fpcr, fpsr)); };
+            const auto cmge = [&](u16 x, u16 y, u16) { return mask(FP::FPCompareGE<u16>(x, y, fpcr, fpsr)); };
+            const auto cmgt = [&](u16 x, u16 y, u16) { return mask(FP::FPCompareGT<u16>(x, y, fpcr, fpsr)); };
+            const auto acge = [&](u16 x, u16 y, u16) { return mask(FP::FPCompareGE<u16>(x & 0x7fff, y & 0x7fff, fpcr, fpsr)); };
+            const auto acgt = [&](u16 x, u16 y, u16) { return mask(FP::FPCompareGT<u16>(x & 0x7fff, y & 0x7fff, fpcr, fpsr)); };
+            const auto cmge_zero = [&](u16 x, u16, u16) { return mask(FP::FPCompareGE<u16>(x, 0, fpcr, fpsr)); };
+            const auto cmgt_zero = [&](u16 x, u16, u16) { return mask(FP::FPCompareGT<u16>(x, 0, fpcr, fpsr)); };
+            const auto cmle_zero = [&](u16 x, u16, u16) { return mask(FP::FPCompareGE<u16>(0, x, fpcr, fpsr)); };
+            const auto cmlt_zero = [&](u16 x, u16, u16) { return mask(FP::FPCompareGT<u16>(0, x, fpcr, fpsr)); };
+
+            // As for the other element sizes, infinity times zero in FMULX also raises invalid operation on x86,
+            // so only its results are compared.
+            const auto check = [&](size_t block, size_t lanes, auto fn, bool check_fpsr = true) {
+                fpsr = FP::FPSR{};
+                const Vector expected = lanewise(lanes, a, b, c, fn);
+                REQUIRE(run(block, a, b, c) == expected);
+                if (check_fpsr) {
+                    REQUIRE((jit.GetFpsr() & 0x9f) == fpsr.Value());
+                }
+            };
+
+            INFO("fpcr " << std::hex << fpcr_value << " inputs " << a[0] << " " << a[1] << " " << b[0] << " " << b[1] << " " << c[0] << " " << c[1]);
+            check(0, 8, mla);
+            check(1, 8, mulx, false);
+            check(2, 8, cmeq);
+            check(3, 8, cmge);
+            check(4, 8, cmgt);
+            check(5, 8, acge);
+            check(6, 8, acgt);
+            check(7, 8, cmge_zero);
+            check(8, 8, cmgt_zero);
+            check(9, 8, cmle_zero);
+            check(10, 8, cmlt_zero);
+            check(11, 4, mulx, false);
+        }
+    }
+}
+
+TEST_CASE("A64: FMADD, FRINT<x>, FCVT (scalar, half-precision)", "[a64]") {
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x1fc20c20); // FMADD H0, H1, H2, H3
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x1ee44020); // FRINTN H0, H1
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x1ee4c020); // FRINTP H0, H1
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x1ee54020); // FRINTM H0, H1
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x1ee5c020); // FRINTZ H0, H1
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x1ee64020); // FRINTA H0, H1
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x1ee74020); // FRINTX H0, H1
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x1ee7c020); // FRINTI H0, H1
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x1ee24020); // FCVT S0, H1
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x1ee2c020); // FCVT D0, H1
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x1e23c020); // FCVT H0, S1
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    const std::array<u16, 14> special{0x0000, 0x8000, 0x0001, 0x03ff, 0x0400, 0x3c00, 0xbc00,
+                                      0x7bff, 0xfbff, 0x7c00, 0xfc00, 0x7e00, 0x7c01, 0xfe01};
+
+    const auto random_half = [&] {
+        return RandInt<int>(0, 2) == 0 ? special[RandInt<size_t>(0, special.size() - 1)] : RandInt<u16>(0, 0xFFFF);
+    };
+
+    const auto run = [&](size_t block, u64 a, u64 b, u64 c) {
+        jit.SetPC(block * 8);
+        jit.SetVector(0, {0, 0});
+        jit.SetVector(1, {a, 0});
+        jit.SetVector(2, {b, 0});
+        jit.SetVector(3, {c, 0});
+        jit.SetFpsr(0);
+
+        env.ticks_left = 2;
+        jit.Run();
+
+        return jit.GetVector(0)[0];
+    };
+
+    for (u32 fpcr_value : {0x00000000, 0x02000000, 0x00400000, 0x00800000, 0x00c00000, 0x01000000, 0x00080000, 0x01080000}) {
+        const FP::FPCR fpcr{fpcr_value};
+        jit.SetFpcr(fpcr_value);
+
+        for (size_t iteration = 0; iteration < 500; iteration++) {
+            const u16 a = random_half();
+            const u16 b = random_half();
+            const u16 c = random_half();
+            const u32 single = RandInt<int>(0, 1) == 0 ? RandInt<u32>(0, 0xFFFFFFFF) : u32(RandInt<u32>(0, 0x7FFFF)) << (RandInt<int>(0, 1) ? 13 : 0);
+
+            // Input denormals flushed by FPCR.FZ (FPSR.IDC) are not reported by the JIT, so only IOC to IXC are compared.
+            FP::FPSR fpsr;
+            const auto check = [&](size_t block, u64 a_value, u64 expected) {
+                REQUIRE(run(block, a_value, b, c) == expected);
+                REQUIRE((jit.GetFpsr() & 0x1f) == (fpsr.Value() & 0x1f));
+                fpsr = FP::FPSR{};
+            };
+
+            INFO("fpcr " << std::hex << fpcr_value << " inputs " << a << " " << b << " " << c << " " << single);
+            check(0, a, FP::FPMulAdd<u16>(c, a, b, fpcr, fpsr));
+            check(1, a, FP::FPRoundInt<u16>(a, fpcr, FP::RoundingMode::ToNearest_TieEven, false, fpsr));
+            check(2, a, FP::FPRoundInt<u16>(a, fpcr, FP::RoundingMode::TowardsPlusInfinity, false, fpsr));
+            check(3, a, FP::FPRoundInt<u16>(a, fpcr, FP::RoundingMode::TowardsMinusInfinity, false, fpsr));
+            check(4, a, FP::FPRoundInt<u16>(a, fpcr, FP::RoundingMode::TowardsZero, false, fpsr));
+            check(5, a, FP::FPRoundInt<u16>(a, fpcr, FP::RoundingMode::ToNearest_TieAwayFromZero, false, fpsr));
+            check(6, a, FP::FPRoundInt<u16>(a, fpcr, fpcr.RMode(), true, fpsr));
+            check(7, a, FP::FPRoundInt<u16>(a, fpcr, fpcr.RMode(), false, fpsr));
+            check(8, a, FP::FPConvert<u32, u16>(a, fpcr, fpcr.RMode(), fpsr));
+            check(9, a, FP::FPConvert<u64, u16>(a, fpcr, fpcr.RMode(), fpsr));
+            check(10, single, FP::FPConvert<u16, u32>(single, fpcr, fpcr.RMode(), fpsr));
+        }
+    }
+}
+
+TEST_CASE("A64: LD2, LD3, LD4, ST2, ST3, ST4 (multiple structures)", "[a64]") {
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    // LDn/STn {V30.T, ...}, [X1], #imm for every arrangement; each followed by B .
+    struct Variant {
+        bool load;
+        size_t selem;
+        size_t size;
+        bool Q;
+    };
+    std::vector<Variant> variants;
+    for (bool load : {true, false}) {
+        for (size_t selem : {2, 3, 4}) {
+            for (size_t size = 0; size < 4; size++) {
+                for (bool Q : {false, true}) {
+                    if (size == 3 && !Q) {
+                        continue;
+                    }
+                    const u32 opcode = selem == 2 ? 0b1000 : selem == 3 ? 0b0100 : 0b0000;
+                    env.code_mem.emplace_back((load ? 0x0cdf003e : 0x0c9f003e) | u32(Q) << 30 | opcode << 12 | u32(size) << 10);
+                    env.code_mem.emplace_back(0x14000000); // B .
+                    variants.push_back({load, selem, size, Q});
+                }
+            }
+        }
+    }
+
+    constexpr u64 address = 0x10000;
+
+    for (size_t iteration = 0; iteration < 10; iteration++) {
+        for (size_t block = 0; block < variants.size(); block++) {
+            const auto [load, selem, size, Q] = variants[block];
+            const size_t ebytes = size_t(1) << size;
+            const size_t register_bytes = Q ? 16 : 8;
+            const size_t total_bytes = selem * register_bytes;
+
+            std::array<std::array<u8, 16>, 4> registers{};
+            env.modified_memory.clear();
+            if (load) {
+                for (size_t i = 0; i < total_bytes; i++) {
+                    env.modified_memory[address + i] = static_cast<u8>(RandInt<u32>(0, 0xFF));
+                }
+            } else {
+                for (auto& reg : registers) {
+                    for (size_t i = 0; i < register_bytes; i++) {
+                        reg[i] = static_cast<u8>(RandInt<u32>(0, 0xFF));
+                    }
+                }
+            }
+
+            jit.SetPC(block * 8);
+            jit.SetRegister(1, address);
+            for (size_t s = 0; s < 4; s++) {
+                Vector value{};
+                std::memcpy(value.data(), registers[s].data(), 16);
+                jit.SetVector((30 + s) % 32, value);
+            }
+
+            env.ticks_left = 2;
+            jit.Run();
+
+            INFO("block " << block << " load " << load << " selem " << selem << " size " << size << " Q " << Q);
+            REQUIRE(jit.GetRegister(1) == address + total_bytes);
+            REQUIRE(env.modified_memory.size() == total_bytes);
+
+            for (size_t s = 0; s < selem; s++) {
+                const Vector value = jit.GetVector((30 + s) % 32);
+                std::array<u8, 16> bytes;
+                std::memcpy(bytes.data(), value.data(), 16);
+
+                for (size_t i = 0; i < 16; i++) {
+                    const u64 byte_address = address + ((i / ebytes) * selem + s) * ebytes + i % ebytes;
+                    if (i >= register_bytes) {
+                        REQUIRE(bytes[i] == (load ? 0 : registers[s][i]));
+                    } else if (load) {
+                        REQUIRE(bytes[i] == env.modified_memory[byte_address]);
+                    } else {
+                        REQUIRE(env.modified_memory[byte_address] == registers[s][i]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("A64: Repeated expressions across stores and flag-setting instructions", "[a64]") {
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0xf9400420); // LDR X0, [X1, #8]
+    env.code_mem.emplace_back(0xf9000422); // STR X2, [X1, #8]
+    env.code_mem.emplace_back(0xf9400423); // LDR X3, [X1, #8]
+    env.code_mem.emplace_back(0xab0600a4); // ADDS X4, X5, X6
+    env.code_mem.emplace_back(0x8b0600a7); // ADD X7, X5, X6
+    env.code_mem.emplace_back(0x9a0600a8); // ADC X8, X5, X6
+    env.code_mem.emplace_back(0x91002029); // ADD X9, X1, #8
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetRegister(1, 0x1000);
+    jit.SetRegister(2, 0xAAAA);
+    jit.SetRegister(5, 0xFFFFFFFFFFFFFFFF);
+    jit.SetRegister(6, 2);
+    jit.SetPC(0);
+
+    env.ticks_left = 8;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(0) == 0x0f0e0d0c0b0a0908);
+    REQUIRE(jit.GetRegister(3) == 0xAAAA);
+    REQUIRE(jit.GetRegister(4) == 1);
+    REQUIRE(jit.GetRegister(7) == 1);
+    REQUIRE(jit.GetRegister(8) == 2);
+    REQUIRE(jit.GetRegister(9) == 0x1008);
+    REQUIRE(jit.GetPstate() == 0x20000000);
+}
+
+TEST_CASE("A64: Constant folding of arithmetic, EXTR, CSEL and vector operations", "[a64]") {
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0xd28000a0); // MOVZ X0, #5
+    env.code_mem.emplace_back(0x91000c01); // ADD X1, X0, #3
+    env.code_mem.emplace_back(0xf1002022); // SUBS X2, X1, #8
+    env.code_mem.emplace_back(0x91004083); // ADD X3, X4, #16
+    env.code_mem.emplace_back(0xd1001063); // SUB X3, X3, #4
+    env.code_mem.emplace_back(0xca040085); // EOR X5, X4, X4
+    env.code_mem.emplace_back(0x6f05e540); // MOVI V0.2D, #0xff00ff00ff00ff00
+    env.code_mem.emplace_back(0x4ee08401); // ADD V1.2D, V0.2D, V0.2D
+    env.code_mem.emplace_back(0x93c11006); // EXTR X6, X0, X1, #4
+    env.code_mem.emplace_back(0x4e183c27); // UMOV X7, V1.D[1]
+    env.code_mem.emplace_back(0x9a81e008); // CSEL X8, X0, X1, AL
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetRegister(4, 100);
+    jit.SetPC(0);
+
+    env.ticks_left = env.code_mem.size();
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(0) == 5);
+    REQUIRE(jit.GetRegister(1) == 8);
+    REQUIRE(jit.GetRegister(2) == 0);
+    REQUIRE(jit.GetRegister(3) == 112);
+    REQUIRE(jit.GetRegister(5) == 0);
+    REQUIRE(jit.GetVector(0) == Vector{0xff00ff00ff00ff00, 0xff00ff00ff00ff00});
+    REQUIRE(jit.GetVector(1) == Vector{0xfe01fe01fe01fe00, 0xfe01fe01fe01fe00});
+    REQUIRE(jit.GetRegister(6) == 0x5000000000000000);
+    REQUIRE(jit.GetRegister(7) == 0xfe01fe01fe01fe00);
+    REQUIRE(jit.GetRegister(8) == 5);
+    REQUIRE(jit.GetPstate() == 0x60000000);
+}
+
+TEST_CASE("A64: Store-to-load forwarding and overwritten stores", "[a64]") {
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0xb9000401); // STR W1, [X0, #4]
+    env.code_mem.emplace_back(0xb9400402); // LDR W2, [X0, #4]
+    env.code_mem.emplace_back(0xb9000803); // STR W3, [X0, #8]
+    env.code_mem.emplace_back(0xb9400404); // LDR W4, [X0, #4]
+    env.code_mem.emplace_back(0xb9001005); // STR W5, [X0, #16]
+    env.code_mem.emplace_back(0xb9001006); // STR W6, [X0, #16]
+    env.code_mem.emplace_back(0x39401407); // LDRB W7, [X0, #5]
+    env.code_mem.emplace_back(0xb900012a); // STR W10, [X9]
+    env.code_mem.emplace_back(0xb940040b); // LDR W11, [X0, #4]
+    env.code_mem.emplace_back(0xf940080c); // LDR X12, [X0, #16]
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetRegister(0, 0x2000);
+    jit.SetRegister(1, 0x11223344);
+    jit.SetRegister(3, 0x55667788);
+    jit.SetRegister(5, 0xAAAAAAAA);
+    jit.SetRegister(6, 0xBBBBBBBB);
+    jit.SetRegister(9, 0x2004);
+    jit.SetRegister(10, 0xCCCCCCCC);
+    jit.SetPC(0);
+
+    env.ticks_left = env.code_mem.size();
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(2) == 0x11223344);
+    REQUIRE(jit.GetRegister(4) == 0x11223344);
+    REQUIRE(jit.GetRegister(7) == 0x33);
+    REQUIRE(jit.GetRegister(11) == 0xCCCCCCCC);
+    REQUIRE(jit.GetRegister(12) == 0x17161514BBBBBBBB);
+    REQUIRE(env.MemoryRead32(0x2008) == 0x55667788);
+}
+
+TEST_CASE("A64: Loads from read-only memory", "[a64]") {
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem_is_read_only = true;
+    env.code_mem.emplace_back(0x580000c1); // LDR X1, 0x18
+    env.code_mem.emplace_back(0x9c0000a0); // LDR Q0, 0x18
+    env.code_mem.emplace_back(0x180000c2); // LDR W2, 0x20
+    env.code_mem.emplace_back(0x580000e3); // LDR X3, 0x28
+    env.code_mem.emplace_back(0xb9400064); // LDR W4, [X3]
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x33221100);
+    env.code_mem.emplace_back(0x77665544);
+    env.code_mem.emplace_back(0xbbaa9988);
+    env.code_mem.emplace_back(0xffeeddcc);
+    env.code_mem.emplace_back(0x0000001c);
+    env.code_mem.emplace_back(0x00000000);
+
+    jit.SetPC(0);
+
+    env.ticks_left = 6;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(1) == 0x7766554433221100);
+    REQUIRE(jit.GetVector(0) == Vector{0x7766554433221100, 0xffeeddccbbaa9988});
+    REQUIRE(jit.GetRegister(2) == 0xbbaa9988);
+    REQUIRE(jit.GetRegister(3) == 0x1c);
+    REQUIRE(jit.GetRegister(4) == 0x77665544);
+    REQUIRE(jit.GetPC() == 0x14);
+}
+
+TEST_CASE("A64: Carry flag consumed within a block", "[a64]") {
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0xab020000); // ADDS X0, X0, X2
+    env.code_mem.emplace_back(0xba030021); // ADCS X1, X1, X3
+    env.code_mem.emplace_back(0xea0f01cd); // ANDS X13, X14, X15
+    env.code_mem.emplace_back(0x9a1f03f0); // ADC X16, XZR, XZR
+    env.code_mem.emplace_back(0xeb090107); // SUBS X7, X8, X9
+    env.code_mem.emplace_back(0xda0c016a); // SBC X10, X11, X12
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetRegister(0, 0xFFFFFFFFFFFFFFFF);
+    jit.SetRegister(1, 0xFFFFFFFFFFFFFFFF);
+    jit.SetRegister(2, 1);
+    jit.SetRegister(3, 0);
+    jit.SetRegister(8, 3);
+    jit.SetRegister(9, 5);
+    jit.SetRegister(11, 10);
+    jit.SetRegister(12, 3);
+    jit.SetRegister(14, 0xF0);
+    jit.SetRegister(15, 0x0F);
+    jit.SetPC(0);
+
+    env.ticks_left = env.code_mem.size();
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(0) == 0);
+    REQUIRE(jit.GetRegister(1) == 0);
+    REQUIRE(jit.GetRegister(13) == 0);
+    REQUIRE(jit.GetRegister(16) == 0);
+    REQUIRE(jit.GetRegister(7) == 0xFFFFFFFFFFFFFFFE);
+    REQUIRE(jit.GetRegister(10) == 6);
+    REQUIRE(jit.GetPstate() == 0x80000000);
+}
+
+TEST_CASE("A64: Redundant extensions and masks", "[a64]") {
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x39400020); // LDRB W0, [X1]
+    env.code_mem.emplace_back(0x12001c02); // AND W2, W0, #0xFF
+    env.code_mem.emplace_back(0x53001c03); // UXTB W3, W0
+    env.code_mem.emplace_back(0x13001c04); // SXTB W4, W0
+    env.code_mem.emplace_back(0x53047c05); // LSR W5, W0, #4
+    env.code_mem.emplace_back(0x12000ca7); // AND W7, W5, #0xF
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetRegister(1, 0x1090);
+    jit.SetPC(0);
+
+    env.ticks_left = env.code_mem.size();
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(0) == 0x90);
+    REQUIRE(jit.GetRegister(2) == 0x90);
+    REQUIRE(jit.GetRegister(3) == 0x90);
+    REQUIRE(jit.GetRegister(4) == 0xFFFFFF90);
+    REQUIRE(jit.GetRegister(5) == 0x9);
+    REQUIRE(jit.GetRegister(7) == 0x9);
+}
+
+TEST_CASE("A64: Memory accesses with folded address arithmetic", "[a64]") {
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0xf9400420); // LDR X0, [X1, #8]
+    env.code_mem.emplace_back(0xf8637822); // LDR X2, [X1, X3, LSL #3]
+    env.code_mem.emplace_back(0x38636825); // LDRB W5, [X1, X3]
+    env.code_mem.emplace_back(0xb8237826); // STR W6, [X1, X3, LSL #2]
+    env.code_mem.emplace_back(0xf85f8027); // LDUR X7, [X1, #-8]
+    env.code_mem.emplace_back(0xf81f0c24); // STR X4, [X1, #-16]!
+    env.code_mem.emplace_back(0xf9400828); // LDR X8, [X1, #16]
+    env.code_mem.emplace_back(0xf86c7989); // LDR X9, [X12, X12, LSL #3]
+    env.code_mem.emplace_back(0xf82b696a); // STR X10, [X11, X11]
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetRegister(1, 0x1000);
+    jit.SetRegister(3, 2);
+    jit.SetRegister(4, 0x1122334455667788);
+    jit.SetRegister(6, 0xAABBCCDD);
+    jit.SetRegister(10, 0x0123456789ABCDEF);
+    jit.SetRegister(11, 0x900);
+    jit.SetRegister(12, 0x100);
+    jit.SetPC(0);
+
+    env.ticks_left = env.code_mem.size();
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(0) == 0x0F0E0D0C0B0A0908);
+    REQUIRE(jit.GetRegister(1) == 0x0FF0);
+    REQUIRE(jit.GetRegister(2) == 0x1716151413121110);
+    REQUIRE(jit.GetRegister(5) == 0x02);
+    REQUIRE(jit.GetRegister(7) == 0xFFFEFDFCFBFAF9F8);
+    REQUIRE(jit.GetRegister(8) == 0x0706050403020100);
+    REQUIRE(jit.GetRegister(9) == 0x0706050403020100);
+    REQUIRE(env.MemoryRead32(0x1008) == 0xAABBCCDD);
+    REQUIRE(env.MemoryRead64(0x0FF0) == 0x1122334455667788);
+    REQUIRE(env.MemoryRead64(0x1200) == 0x0123456789ABCDEF);
+}
+
+TEST_CASE("A64: Accesses sharing a page table lookup", "[a64]") {
+    A64TestEnv env;
+
+    std::vector<u8> memory(3 * 0x1000);
+    for (size_t i = 0; i < memory.size(); i++) {
+        memory[i] = static_cast<u8>(i * 7 + 3);
+    }
+    const auto host_read64 = [&](u64 vaddr) {
+        u64 value;
+        std::memcpy(&value, &memory[vaddr], sizeof(value));
+        return value;
+    };
+
+    // Pages 0 to 2 are backed by memory; all others go through the callbacks.
+    std::array<void*, 256> page_table{};
+    for (size_t page = 0; page < 3; page++) {
+        page_table[page] = &memory[page * 0x1000];
+    }
+
+    Dynarmic::A64::UserConfig conf{&env};
+    conf.page_table = page_table.data();
+    conf.reuse_page_table_lookups = true;
+    conf.page_table_address_space_bits = 20;
+    Dynarmic::A64::Jit jit{conf};
+
+    env.code_mem_start_address = 0x80000;
+    env.code_mem.emplace_back(0xa9400820); // LDP X0, X2, [X1]
+    env.code_mem.emplace_back(0xa9011424); // STP X4, X5, [X1, #16]
+    env.code_mem.emplace_back(0xf9400c26); // LDR X6, [X1, #24]
+    env.code_mem.emplace_back(0xad410420); // LDP Q0, Q1, [X1, #32]
+    env.code_mem.emplace_back(0xad020420); // STP Q0, Q1, [X1, #64]
+    env.code_mem.emplace_back(0xf85f8127); // LDUR X7, [X9, #-8]
+    env.code_mem.emplace_back(0xf9400128); // LDR X8, [X9]
+    env.code_mem.emplace_back(0xa9402d8a); // LDP X10, X11, [X12]
+    env.code_mem.emplace_back(0xa9011584); // STP X4, X5, [X12, #16]
+    env.code_mem.emplace_back(0xa93f95a4); // STP X4, X5, [X13, #-8]
+    env.code_mem.emplace_back(0xad7f8da2); // LDP Q2, Q3, [X13, #-16]
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetRegister(1, 0x1100);
+    jit.SetRegister(4, 0x1122334455667788);
+    jit.SetRegister(5, 0x99AABBCCDDEEFF00);
+    jit.SetRegister(9, 0x2000);
+    jit.SetRegister(12, 0x3000);
+    jit.SetRegister(13, 0x1000);
+    jit.SetPC(0x80000);
+
+    env.ticks_left = env.code_mem.size();
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(0) == host_read64(0x1100));
+    REQUIRE(jit.GetRegister(2) == host_read64(0x1108));
+    REQUIRE(host_read64(0x1110) == 0x1122334455667788);
+    REQUIRE(host_read64(0x1118) == 0x99AABBCCDDEEFF00);
+    REQUIRE(jit.GetRegister(6) == 0x99AABBCCDDEEFF00);
+    REQUIRE(jit.GetVector(0) == Vector{host_read64(0x1120), host_read64(0x1128)});
+    REQUIRE(jit.GetVector(1) == Vector{host_read64(0x1130), host_read64(0x1138)});
+    REQUIRE(host_read64(0x1140) == host_read64(0x1120));
+    REQUIRE(host_read64(0x1158) == host_read64(0x1138));
+
+    // These straddle a page boundary, so each is looked up individually.
+    REQUIRE(jit.GetRegister(7) == host_read64(0x1FF8));
+    REQUIRE(jit.GetRegister(8) == host_read64(0x2000));
+    REQUIRE(host_read64(0x0FF8) == 0x1122334455667788);
+    REQUIRE(host_read64(0x1000) == 0x99AABBCCDDEEFF00);
+    REQUIRE(jit.GetVector(2) == Vector{host_read64(0x0FF0), host_read64(0x0FF8)});
+    REQUIRE(jit.GetVector(3) == Vector{host_read64(0x1000), host_read64(0x1008)});
+
+    // These are to an unmapped page.
+    REQUIRE(jit.GetRegister(10) == 0x0706050403020100);
+    REQUIRE(jit.GetRegister(11) == 0x0F0E0D0C0B0A0908);
+    REQUIRE(env.MemoryRead64(0x3010) == 0x1122334455667788);
+    REQUIRE(env.MemoryRead64(0x3018) == 0x99AABBCCDDEEFF00);
+
+    // Registers borrowed by the slow paths are restored.
+    REQUIRE(jit.GetRegister(1) == 0x1100);
+    REQUIRE(jit.GetRegister(9) == 0x2000);
+    REQUIRE(jit.GetRegister(12) == 0x3000);
+    REQUIRE(jit.GetRegister(13) == 0x1000);
+}
+
+TEST_CASE("A64: Merged load pairs", "[a64]") {
+    A64TestEnv env;
+
+    // Pages 1 and 2 are backed by separate buffers; all others go through the callbacks.
+    std::array<std::vector<u8>, 2> pages{std::vector<u8>(0x1000), std::vector<u8>(0x1000)};
+    for (size_t i = 0; i < 0x1000; i++) {
+        pages[0][i] = static_cast<u8>(i * 7 + 3);
+        pages[1][i] = static_cast<u8>(i * 5 + 1);
+    }
+    const auto host_read = [&](u64 vaddr, size_t bytes) {
+        u64 value = 0;
+        std::memcpy(&value, &pages[vaddr / 0x1000 - 1][vaddr % 0x1000], bytes);
+        return value;
+    };
+
+    std::array<void*, 256> page_table{};
+    page_table[1] = pages[0].data();
+    page_table[2] = pages[1].data();
+
+    Dynarmic::A64::UserConfig conf{&env};
+    conf.page_table = page_table.data();
+    conf.reuse_page_table_lookups = true;
+    conf.page_table_address_space_bits = 20;
+    Dynarmic::A64::Jit jit{conf};
+
+    env.code_mem_start_address = 0x80000;
+    env.code_mem.emplace_back(0xa9400440); // LDP X0, X1, [X2]
+    env.code_mem.emplace_back(0x29421043); // LDP W3, W4, [X2, #16]
+    env.code_mem.emplace_back(0xa94018e5); // LDP X5, X6, [X7]
+    env.code_mem.emplace_back(0x29402548); // LDP W8, W9, [X10]
+    env.code_mem.emplace_back(0x294031ab); // LDP W11, W12, [X13]
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetRegister(2, 0x1100);
+    jit.SetRegister(7, 0x1FF8);
+    jit.SetRegister(10, 0x2FFC);
+    jit.SetRegister(13, 0x5000);
+    jit.SetPC(0x80000);
+
+    env.ticks_left = env.code_mem.size();
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(0) == host_read(0x1100, 8));
+    REQUIRE(jit.GetRegister(1) == host_read(0x1108, 8));
+    REQUIRE(jit.GetRegister(3) == host_read(0x1110, 4));
+    REQUIRE(jit.GetRegister(4) == host_read(0x1114, 4));
+
+    // These pairs straddle a page boundary.
+    REQUIRE(jit.GetRegister(5) == host_read(0x1FF8, 8));
+    REQUIRE(jit.GetRegister(6) == host_read(0x2000, 8));
+    REQUIRE(jit.GetRegister(8) == host_read(0x2FFC, 4));
+    REQUIRE(jit.GetRegister(9) == 0x03020100);
+
+    // This pair is entirely within an unmapped page.
+    REQUIRE(jit.GetRegister(11) == 0x03020100);
+    REQUIRE(jit.GetRegister(12) == 0x07060504);
+
+    // Registers borrowed by the slow paths are restored.
+    REQUIRE(jit.GetRegister(2) == 0x1100);
+    REQUIRE(jit.GetRegister(7) == 0x1FF8);
+    REQUIRE(jit.GetRegister(10) == 0x2FFC);
+    REQUIRE(jit.GetRegister(13) == 0x5000);
+}
+
+TEST_CASE("A64: Bitfield moves", "[a64]") {
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    // Computes SBFM (opc == 0), BFM (opc == 1) and UBFM (opc == 2) as described by the architecture pseudocode.
+    const auto reference = [](u32 opc, size_t datasize, size_t R, size_t S, u64 dst, u64 src) -> u64 {
+        const auto ones = [](size_t count) { return count >= 64 ? ~u64(0) : (u64(1) << count) - 1; };
+        const auto ror = [&](u64 value, size_t amount) {
+            value &= ones(datasize);
+            return amount == 0 ? value : ((value >> amount) | (value << (datasize - amount))) & ones(datasize);
+        };
+
+        const u64 wmask = ror(ones(S + 1), R);
+        const u64 tmask = ones(((S - R) & (datasize - 1)) + 1);
+        const u64 bot = ror(src, R) & wmask;
+
+        switch (opc) {
+        case 0: {
+            const u64 top = ((src >> S) & 1) != 0 ? ones(datasize) : 0;
+            return (top & ~tmask) | (bot & tmask);
+        }
+        case 1:
+            return ((dst & ~tmask) | (((dst & ~wmask) | bot) & tmask)) & ones(datasize);
+        default:
+            return bot & tmask;
+        }
+    };
+
+    struct Case {
+        u32 opc;
+        size_t datasize;
+        size_t R;
+        size_t S;
+        u32 n;
+    };
+    std::vector<Case> cases;
+
+    // Each instruction is followed by a branch to itself. Rd is X0; Rn is X1, or X0 itself.
+    for (u32 opc = 0; opc < 3; opc++) {
+        for (const bool sf : {false, true}) {
+            const size_t datasize = sf ? 64 : 32;
+            for (size_t R = 0; R < datasize; R++) {
+                for (size_t S = 0; S < datasize; S++) {
+                    for (const u32 n : {1, 0}) {
+                        cases.push_back({opc, datasize, R, S, n});
+                        env.code_mem.emplace_back((sf ? 0x80400000 : 0) | (opc << 29) | 0x13000000 | static_cast<u32>(R << 16) | static_cast<u32>(S << 10) | (n << 5));
+                        env.code_mem.emplace_back(0x14000000); // B .
+                    }
+                }
+            }
+        }
+    }
+
+    for (size_t i = 0; i < cases.size(); i++) {
+        const Case& c = cases[i];
+        const u64 dst = 0x0123456789ABCDEF;
+        const u64 src = c.n == 0 ? dst : 0xF0E1D2C3B4A59687;
+
+        jit.SetRegister(0, dst);
+        jit.SetRegister(1, src);
+        jit.SetPC(i * 8);
+
+        env.ticks_left = 2;
+        jit.Run();
+
+        INFO("instruction: " << std::hex << env.code_mem[i * 2]);
+        REQUIRE(jit.GetRegister(0) == reference(c.opc, c.datasize, c.R, c.S, dst, src));
+    }
+
+    // The same operations on constant operands are folded away.
+    env.code_mem = {
+        0xd292d0e1, // MOV X1, #0x9687
+        0xf2b694a1, // MOVK X1, #0xB4A5, LSL #16
+        0xd2e24684, // MOV X4, #0x1234000000000000
+        0x934c4c22, // SBFX X2, X1, #12, #8
+        0xd3445c23, // UBFX X3, X1, #4, #20
+        0xb3582c24, // BFI X4, X1, #40, #12
+        0x131b7825, // SBFX W5, W1, #27, #4
+        0x14000000, // B .
+    };
+    jit.ClearCache();
+    jit.SetPC(0);
+
+    env.ticks_left = env.code_mem.size();
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(2) == 0x59);
+    REQUIRE(jit.GetRegister(3) == 0xA5968);
+    REQUIRE(jit.GetRegister(4) == 0x1236870000000000);
+    REQUIRE(jit.GetRegister(5) == 6);
+}
+
+TEST_CASE("A64: Variable shifts, rotates and high multiply", "[a64]") {
+    A64TestEnv env;
+    Dynarmic::A64::Jit jit{Dynarmic::A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x9ac22020); // LSL X0, X1, X2
+    env.code_mem.emplace_back(0x9ac22423); // LSR X3, X1, X2
+    env.code_mem.emplace_back(0x9ac22824); // ASR X4, X1, X2
+    env.code_mem.emplace_back(0x1ac62025); // LSL W5, W1, W6
+    env.code_mem.emplace_back(0x1ac62427); // LSR W7, W1, W6
+    env.code_mem.emplace_back(0x1ac62828); // ASR W8, W1, W6
+    env.code_mem.emplace_back(0xaac137e9); // ORR X9, XZR, X1, ROR #13
+    env.code_mem.emplace_back(0x2ac11fea); // ORR W10, WZR, W1, ROR #7
+    env.code_mem.emplace_back(0x9bcc7c2b); // UMULH X11, X1, X12
+    env.code_mem.emplace_back(0xcac1f02d); // EOR X13, X1, X1, ROR #60
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetRegister(1, 0x87654321FEDCBA98);
+    jit.SetRegister(2, 65);
+    jit.SetRegister(6, 36);
+    jit.SetRegister(12, 0xF0E1D2C3B4A59687);
+    jit.SetPC(0);
+
+    env.ticks_left = env.code_mem.size();
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(0) == 0x0ECA8643FDB97530);
+    REQUIRE(jit.GetRegister(3) == 0x43B2A190FF6E5D4C);
+    REQUIRE(jit.GetRegister(4) == 0xC3B2A190FF6E5D4C);
+    REQUIRE(jit.GetRegister(5) == 0xEDCBA980);
+    REQUIRE(jit.GetRegister(7) == 0x0FEDCBA9);
+    REQUIRE(jit.GetRegister(8) == 0xFFEDCBA9);
+    REQUIRE(jit.GetRegister(9) == 0xD4C43B2A190FF6E5);
+    REQUIRE(jit.GetRegister(10) == 0x31FDB975);
+    REQUIRE(jit.GetRegister(11) == 0x7F665E68728EBBF9);
+    REQUIRE(jit.GetRegister(13) == 0xF131713E13171310);
+}
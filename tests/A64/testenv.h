@@ -21,6 +21,7 @@ public:
     u64 ticks_left = 0;
 
     bool code_mem_modified_by_guest = false;
+    bool code_mem_is_read_only = false;
     u64 code_mem_start_address = 0;
     std::vector<u32> code_mem;
 
@@ -85,6 +86,10 @@ public:
         MemoryWrite64(vaddr + 8, value[1]);
     }
 
+    bool IsReadOnlyMemory(u64 vaddr) override {
+        return code_mem_is_read_only && IsInCodeMem(vaddr);
+    }
+
     void InterpreterFallback(u64 pc, size_t num_instructions) override { ASSERT_MSG(false, "InterpreterFallback({:016x}, {})", pc, num_instructions); }
 
     void CallSVC(std::uint32_t swi) override { ASSERT_MSG(false, "CallSVC({})", swi); }
@@ -0,0 +1,111 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * This software may be used and distributed according to the terms of the GNU
+ * General Public License version 2 or any later version.
+ */
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+
+#include <catch.hpp>
+
+#include "backend/x64/sm4_tables.h"
+#include "common/common_types.h"
+#include "common/crypto/aes.h"
+#include "common/crypto/sm4.h"
+
+using namespace Dynarmic;
+using namespace Dynarmic::BackendX64::SM4Tables;
+namespace AES = Dynarmic::Common::Crypto::AES;
+namespace SM4 = Dynarmic::Common::Crypto::SM4;
+
+// These model the host instructions used by each SM4 S-box lowering, so that every set of constants
+// is checked regardless of which instructions the host running the tests supports.
+namespace {
+
+// PSHUFB, for a single byte.
+u8 Shuffle(const std::array<u64, 2>& table, u8 index) {
+    if (index & 0x80) {
+        return 0;
+    }
+    return static_cast<u8>(table[(index >> 3) & 1] >> ((index & 7) * 8));
+}
+
+u8 NibbleTransform(const std::array<u64, 2>& low_nibble, const std::array<u64, 2>& high_nibble, u8 x) {
+    return Shuffle(low_nibble, x & 0xF) ^ Shuffle(high_nibble, x >> 4);
+}
+
+// Multiplication in the AES field (modulo x^8+x^4+x^3+x+1).
+u8 Multiply(u8 a, u8 b) {
+    u8 result = 0;
+    while (b != 0) {
+        if (b & 1) {
+            result ^= a;
+        }
+        a = static_cast<u8>((a << 1) ^ ((a & 0x80) ? 0x1B : 0));
+        b >>= 1;
+    }
+    return result;
+}
+
+u8 Inverse(u8 x) {
+    for (size_t y = 1; y < 256 && x != 0; y++) {
+        if (Multiply(x, static_cast<u8>(y)) == 1) {
+            return static_cast<u8>(y);
+        }
+    }
+    return 0;
+}
+
+// GF2P8AFFINEQB, for a single byte.
+u8 Affine(u64 matrix, u8 constant, u8 x) {
+    u8 result = 0;
+    for (size_t i = 0; i < 8; i++) {
+        const u8 row = static_cast<u8>(matrix >> ((7 - i) * 8));
+        result |= static_cast<u8>(std::bitset<8>(row & x).count() & 1) << i;
+    }
+    return result ^ constant;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("SM4 S-box: GFNI constants", "[x64]") {
+    for (size_t i = 0; i < 256; i++) {
+        const u8 x = static_cast<u8>(i);
+        const u8 result = Affine(gfni_post_matrix, gfni_post_constant, Inverse(Affine(gfni_pre_matrix, gfni_pre_constant, x)));
+        REQUIRE(result == SM4::AccessSubstitutionBox(x));
+    }
+}
+
+TEST_CASE("SM4 S-box: AES-NI constants", "[x64]") {
+    for (size_t base = 0; base < 256; base += 16) {
+        AES::State input;
+        for (size_t i = 0; i < input.size(); i++) {
+            input[i] = NibbleTransform(aes_pre_low_nibble, aes_pre_high_nibble, static_cast<u8>(base + i));
+        }
+
+        // Equivalent to AESENCLAST with a zero round key.
+        AES::State substituted;
+        AES::EncryptSingleRound(substituted, input);
+
+        for (size_t i = 0; i < input.size(); i++) {
+            const u8 unshifted = substituted[Shuffle(aes_inverse_shift_rows, static_cast<u8>(i)) & 0xF];
+            const u8 result = NibbleTransform(aes_post_low_nibble, aes_post_high_nibble, unshifted);
+            REQUIRE(result == SM4::AccessSubstitutionBox(static_cast<u8>(base + i)));
+        }
+    }
+}
+
+TEST_CASE("SM4 S-box: SSSE3 constants", "[x64]") {
+    for (size_t i = 0; i < 256; i++) {
+        u8 data = static_cast<u8>(i);
+        u8 result = 0;
+        for (const auto& row : substitution_box_rows) {
+            const u8 index = static_cast<u8>(std::min<size_t>(data + 0x70, 0xFF));
+            result |= Shuffle(row, index);
+            data -= 0x10;
+        }
+        REQUIRE(result == SM4::AccessSubstitutionBox(static_cast<u8>(i)));
+    }
+}